@@ -3,23 +3,54 @@
 #include <rexcore/core.hpp>
 #include <rexcore/allocators.hpp>
 #include <rexcore/containers/string.hpp>
+#include <rexcore/containers/utf.hpp>
+#include <rexcore/containers/string_builder.hpp>
+#include <rexcore/containers/constexpr_map.hpp>
+#include <rexcore/containers/concurrent_map.hpp>
+#include <rexcore/containers/incremental_map.hpp>
+#include <rexcore/containers/lru_cache.hpp>
+#include <rexcore/containers/flat_map.hpp>
+#include <rexcore/containers/btree_map.hpp>
+#include <rexcore/containers/slot_map.hpp>
+#include <rexcore/containers/sparse_set.hpp>
+#include <rexcore/containers/bit_vector.hpp>
+#include <rexcore/containers/filters.hpp>
+#include <rexcore/containers/priority_queue.hpp>
+#include <rexcore/containers/timer_wheel.hpp>
 #include <rexcore/containers/vector.hpp>
 #include <rexcore/containers/smart_ptrs.hpp>
 #include <rexcore/containers/set.hpp>
 #include <rexcore/containers/map.hpp>
 #include <rexcore/containers/deque.hpp>
+#include <rexcore/time.hpp>
 #include <rexcore/containers/stack.hpp>
 
 #include <vector>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <charconv>
 #include <unordered_set>
 #include <unordered_map>
+#include <map>
+#include <queue>
+#include <set>
 #include <deque>
 #include <stack>
+#include <thread>
+#include <atomic>
+#include <shared_mutex>
 
 using namespace RexCore;
 
+// Deterministic pseudo-random numbers (64 bits LCG) so the benchmarks always run on the same data.
+// Returns the new state, its low bits have short periods so take the high ones.
+static U64 NextRandom(U64& state)
+{
+	state = state * 6364136223846793005llu + 1442695040888963407llu;
+	return state;
+}
+
 BENCHMARK("Containers/UniquePtr")
 {
 	BENCH_LOOP("UniquePtr", 1'000'000, 1, {
@@ -68,6 +99,65 @@ BENCHMARK("Containers/Function")
 	});
 }
 
+// Callbacks passed as parameters, the way FunctionRef is meant to be used
+static U64 SumCallsFunctionRef(FunctionRef<U64(U64)> func, U64 count)
+{
+	U64 total = 0;
+	for (U64 i = 0; i < count; i++)
+		total += func(i);
+	return total;
+}
+
+static U64 SumCallsFunction(const Function<U64(U64)>& func, U64 count)
+{
+	U64 total = 0;
+	for (U64 i = 0; i < count; i++)
+		total += func(i);
+	return total;
+}
+
+static U64 SumCallsStdFunction(const std::function<U64(U64)>& func, U64 count)
+{
+	U64 total = 0;
+	for (U64 i = 0; i < count; i++)
+		total += func(i);
+	return total;
+}
+
+BENCHMARK("Containers/FunctionRef")
+{
+	constexpr U64 Count = 1'000'000;
+	U64 offset = 3;
+	auto callback = [&offset](U64 x) { return x ^ offset; };
+	U64 total = 0;
+
+	BENCH_LOOP("FunctionRef - Create", Count, 1, {
+		FunctionRef<U64(U64)> ref = callback;
+		total += ref(1);
+	});
+	BENCH_LOOP("Function - Create", Count, 1, {
+		Function<U64(U64)> func = callback;
+		total += func(1);
+	});
+	BENCH_LOOP("std::function - Create", Count, 1, {
+		std::function<U64(U64)> func = callback;
+		total += func(1);
+	});
+
+	Function<U64(U64)> func = callback;
+	std::function<U64(U64)> stdFunc = callback;
+	BENCH_LOOP("FunctionRef - Call", 100, Count, {
+		total += SumCallsFunctionRef(callback, Count);
+	});
+	BENCH_LOOP("Function - Call", 100, Count, {
+		total += SumCallsFunction(func, Count);
+	});
+	BENCH_LOOP("std::function - Call", 100, Count, {
+		total += SumCallsStdFunction(stdFunc, Count);
+	});
+	printf("    Total: %llu\n", total);
+}
+
 BENCHMARK("Containers/Vector")
 {
 	Vector<int> vec;
@@ -135,6 +225,211 @@ BENCHMARK("Containers/String")
 	});
 }
 
+BENCHMARK("Containers/StringSearch")
+{
+	// ~4MB log line with the needle at the very end
+	String<> log;
+	for (int i = 0; log.Size() < 4 * 1024 * 1024; i++)
+	{
+		log += "2024-01-01T00:00:00Z level=info service=gateway msg=\"request handled\" status=200 latency_us=";
+		log += i % 2 == 0 ? "123; " : "4567; ";
+	}
+	log += "level=error msg=\"upstream timeout\"";
+
+	const StringView view = log;
+	const std::string_view stdView(log.Data(), log.Size());
+
+	U64 total = 0;
+	BENCH_LOOP("StringView - Find(char)", 100, view.Size(), {
+		total += view.Find('!');
+	});
+	BENCH_LOOP("std::string_view - find(char)", 100, view.Size(), {
+		total += stdView.find('!');
+	});
+	BENCH_LOOP("StringView - Find(StringView)", 100, view.Size(), {
+		total += view.Find("upstream timeout");
+	});
+	BENCH_LOOP("std::string_view - find(string_view)", 100, view.Size(), {
+		total += stdView.find("upstream timeout");
+	});
+	BENCH_LOOP("StringView - RFind(StringView)", 100, view.Size(), {
+		total += view.RFind("2024-01-01T00:00:01Z");
+	});
+	BENCH_LOOP("std::string_view - rfind(string_view)", 100, view.Size(), {
+		total += stdView.rfind("2024-01-01T00:00:01Z");
+	});
+	BENCH_LOOP("StringView - FindFirstOf", 100, view.Size(), {
+		total += view.FindFirstOf("!#$");
+	});
+	BENCH_LOOP("std::string_view - find_first_of", 100, view.Size(), {
+		total += stdView.find_first_of("!#$");
+	});
+	printf("    Total: %llu\n", total);
+
+	BENCH_LOOP("StringView - SplitInto", 10, 1, {
+		Vector<StringView> split;
+		view.SplitInto(split, "; ");
+		total += split.Size();
+	});
+	BENCH_LOOP("std::string_view - split", 10, 1, {
+		std::vector<std::string_view> split;
+		size_t start = 0;
+		while (start < stdView.size())
+		{
+			size_t found = stdView.find("; ", start);
+			if (found == std::string_view::npos)
+				found = stdView.size();
+			split.push_back(stdView.substr(start, found - start));
+			start = found + 2;
+		}
+		total += split.size();
+	});
+	printf("    Total: %llu\n", total);
+}
+
+BENCHMARK("Containers/StringNumbers")
+{
+	constexpr U64 N = 1'000'000;
+	Vector<U64> values;
+	values.Reserve(N);
+	for (U64 i = 0; i < N; i++)
+		values.PushBack((static_cast<U64>(rand()) << 32llu) | static_cast<U64>(rand()));
+
+	String<> text;
+	U64 total = 0;
+	BENCH_LOOP("String - AppendInt", 10, N, {
+		text.Clear();
+		for (U64 value : values)
+		{
+			text.AppendInt(value);
+			text += ' ';
+		}
+		total += text.Size();
+	});
+	BENCH_LOOP("std::to_chars - int", 10, N, {
+		char buffer[24];
+		for (U64 value : values)
+			total += static_cast<U64>(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer);
+	});
+	printf("    Total: %llu\n", total);
+
+	BENCH_LOOP("StringView - ParseInt", 10, N, {
+		StringView view = text;
+		while (const auto parsed = view.ParseInt<U64>())
+		{
+			total += parsed->value;
+			view = view.SubStr(parsed->length + 1);
+		}
+	});
+	BENCH_LOOP("std::from_chars - int", 10, N, {
+		const char* first = text.Data();
+		const char* last = text.Data() + text.Size();
+		while (first < last)
+		{
+			U64 value;
+			const auto result = std::from_chars(first, last, value);
+			if (result.ec != std::errc{})
+				break;
+			total += value;
+			first = result.ptr + 1;
+		}
+	});
+	printf("    Total: %llu\n", total);
+
+	String<> floatText;
+	BENCH_LOOP("String - AppendFloat", 10, N, {
+		floatText.Clear();
+		for (U64 value : values)
+		{
+			floatText.AppendFloat(static_cast<double>(value) * 1e-9);
+			floatText += ' ';
+		}
+		total += floatText.Size();
+	});
+	BENCH_LOOP("StringView - ParseFloat", 10, N, {
+		StringView view = floatText;
+		while (const auto parsed = view.ParseFloat())
+		{
+			total += static_cast<U64>(parsed->value);
+			view = view.SubStr(parsed->length + 1);
+		}
+	});
+	printf("    Total: %llu\n", total);
+}
+
+BENCHMARK("Containers/Utf")
+{
+	// ~1MB each, mostly ascii markup and mostly 3 bytes CJK text
+	String<> ascii;
+	String<> cjk;
+	while (ascii.Size() < 1024 * 1024)
+		ascii += "<p class=\"note\">Status: ok, caf\xC3\xA9 latency 12ms</p>\n";
+	while (cjk.Size() < 1024 * 1024)
+		cjk += "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88, \xE4\xB8\xAD\xE6\x96\x87\xE6\x96\x87\xE6\x9C\xAC. ";
+
+	const WString<> asciiWide = ToWide(ascii);
+	const WString<> cjkWide = ToWide(cjk);
+
+	U64 total = 0;
+	BENCH_LOOP("ValidateUtf8 - Ascii", 100, ascii.Size(), {
+		total += ValidateUtf8(ascii);
+	});
+	BENCH_LOOP("ValidateUtf8 - CJK", 100, cjk.Size(), {
+		total += ValidateUtf8(cjk);
+	});
+	BENCH_LOOP("ToWide - Ascii", 100, ascii.Size(), {
+		total += ToWide(ascii).Size();
+	});
+	BENCH_LOOP("ToWide - CJK", 100, cjk.Size(), {
+		total += ToWide(cjk).Size();
+	});
+	BENCH_LOOP("ToUtf8 - Ascii", 100, asciiWide.Size(), {
+		total += ToUtf8(asciiWide).Size();
+	});
+	BENCH_LOOP("ToUtf8 - CJK", 100, cjkWide.Size(), {
+		total += ToUtf8(cjkWide).Size();
+	});
+	printf("    Total: %llu\n", total);
+}
+
+BENCHMARK("Containers/StringBuilder")
+{
+	// Builds a ~4MB response out of small fragments
+	constexpr U64 N = 100'000;
+	U64 total = 0;
+	BENCH_LOOP("StringBuilder - Append", 10, N, {
+		StringBuilder<> builder(64 * 1024);
+		for (U64 i = 0; i < N; i++)
+		{
+			builder += "{\"id\":";
+			builder.AppendFormat("{}", i);
+			builder += ",\"name\":\"some item name\"},";
+		}
+		total += builder.ToString().Size();
+	});
+	BENCH_LOOP("String - operator+=", 10, N, {
+		String<> str;
+		for (U64 i = 0; i < N; i++)
+		{
+			str += "{\"id\":";
+			FormatTo(str, "{}", i);
+			str += ",\"name\":\"some item name\"},";
+		}
+		total += str.Size();
+	});
+	BENCH_LOOP("std::string - append", 10, N, {
+		std::string str;
+		for (U64 i = 0; i < N; i++)
+		{
+			str += "{\"id\":";
+			std::format_to(std::back_inserter(str), "{}", i);
+			str += ",\"name\":\"some item name\"},";
+		}
+		total += str.size();
+	});
+	printf("    Total: %llu\n", total);
+}
+
 BENCHMARK("Containers/HashSet")
 {
 	{
@@ -215,6 +510,1046 @@ BENCHMARK("Containers/HashMap")
 	}
 }
 
+BENCHMARK("Containers/StringHashMap")
+{
+	// Long keys looked up in 3 maps each
+	constexpr U32 N = 100'000;
+	Vector<String<>> keys;
+	keys.Reserve(N);
+	for (U32 i = 0; i < N; i++)
+		keys.EmplaceBack(Format("/api/v1/organizations/{}/projects/{}/settings", i % 97, i));
+
+	StringHashMap<U32> maps[3];
+	for (StringHashMap<U32>& map : maps)
+	{
+		for (U32 i = 0; i < N; i++)
+			map.Insert(StringView(keys[i]), i);
+	}
+
+	U64 total = 0;
+	BENCH_LOOP("StringHashMap - Find(StringView)", 10, N, {
+		for (const String<>& key : keys)
+		{
+			for (const StringHashMap<U32>& map : maps)
+				total += map.Find(StringView(key))->second;
+		}
+	});
+	BENCH_LOOP("StringHashMap - Find(HashedStringView)", 10, N, {
+		for (const String<>& key : keys)
+		{
+			const HashedStringView hashed(key);
+			for (const StringHashMap<U32>& map : maps)
+				total += map.Find(hashed)->second;
+		}
+	});
+	printf("    Total: %llu\n", total);
+}
+
+BENCHMARK("Containers/StringHashSet")
+{
+	// Dedup of views into a text buffer
+	constexpr U32 N = 100'000;
+	String<> text;
+	Vector<StringView> words;
+	for (U32 i = 0; i < N; i++)
+		FormatTo(text, "some_identifier_{} ", i % 10'000);
+	for (U32 i = 0, start = 0; i < text.Size(); i++)
+	{
+		if (text.Data()[i] == ' ')
+		{
+			words.PushBack(StringView(text.Data() + start, i - start));
+			start = i + 1;
+		}
+	}
+
+	U64 total = 0;
+	BENCH_LOOP("StringHashSet - Contains(StringView)", 10, N, {
+		StringHashSet<> set;
+		for (const StringView word : words)
+		{
+			if (!set.Contains(word))
+				set.Insert(String<>(word));
+		}
+		total += set.Size();
+	});
+	BENCH_LOOP("HashSet<String> - Contains(String(StringView))", 10, N, {
+		HashSet<String<>> set;
+		for (const StringView word : words)
+		{
+			if (!set.Contains(String<>(word)))
+				set.Insert(String<>(word));
+		}
+		total += set.Size();
+	});
+	printf("    Total: %llu\n", total);
+}
+
+BENCHMARK("Containers/HashMapBatch")
+{
+	// Random lookups in a map much bigger than the caches
+	constexpr U32 N = 10'000'000;
+	constexpr U32 NumLookups = 1'000'000;
+	HashMap<U64, U64> map;
+	map.Reserve(N);
+	for (U64 i = 0; i < N; i++)
+		map.Insert(i * 0x9E3779B97F4A7C15llu, i);
+
+	Vector<U64> keys;
+	keys.Reserve(NumLookups);
+	U64 state = 1;
+	for (U32 i = 0; i < NumLookups; i++)
+		keys.PushBack((NextRandom(state) >> 33llu) % (N + N / 4) * 0x9E3779B97F4A7C15llu); // ~20% misses
+
+	U64 total = 0;
+	BENCH_LOOP("HashMap - Find", 10, NumLookups, {
+		for (const U64 key : keys)
+		{
+			const auto found = map.Find(key);
+			if (found != map.End())
+				total += found->second;
+		}
+	});
+
+	Vector<HashMap<U64, U64>::Iterator> found;
+	found.Resize(NumLookups);
+	BENCH_LOOP("HashMap - FindBatch", 10, NumLookups, {
+		map.FindBatch(keys, found.Data());
+		for (const auto& it : found)
+		{
+			if (it != map.End())
+				total += it->second;
+		}
+	});
+
+	Vector<bool> contains;
+	contains.Resize(NumLookups);
+	BENCH_LOOP("HashMap - ContainsBatch", 10, NumLookups, {
+		map.ContainsBatch(keys, contains.Data());
+		for (const bool c : contains)
+			total += c;
+	});
+	printf("    Total: %llu\n", total);
+}
+
+// Each thread does opsPerThread random operations on keys in [0, keyRange), writePercent of them are inserts
+template<typename FindFn, typename InsertFn>
+static U64 RunMapWorkload(U32 numThreads, U32 opsPerThread, U32 keyRange, U32 writePercent, const FindFn& find, const InsertFn& insert)
+{
+	std::atomic<U64> total = 0;
+	Vector<std::thread> threads;
+	threads.Reserve(numThreads);
+	for (U32 ti = 0; ti < numThreads; ti++)
+	{
+		threads.EmplaceBack([&, ti] {
+			U64 state = ti + 1;
+			U64 localTotal = 0;
+			for (U32 i = 0; i < opsPerThread; i++)
+			{
+				const U64 random = NextRandom(state);
+				const U64 key = (random >> 33llu) % keyRange;
+				if ((random >> 20llu) % 100 < writePercent)
+					insert(key);
+				else
+					localTotal += find(key);
+			}
+			total += localTotal;
+		});
+	}
+
+	for (auto& t : threads)
+		t.join();
+	return total;
+}
+
+// Average and worst insert time, the worst is the insert that grows the table
+template<typename MapT>
+static void BenchInsertLatency(const char* name, U64 count)
+{
+	MapT map;
+	Stopwatch total;
+	U64 worst = 0;
+	for (U64 i = 0; i < count; i++)
+	{
+		Stopwatch sw;
+		map.Insert(i * 0x9E3779B97F4A7C15llu, i);
+		worst = Math::Max(worst, sw.ElapsedNs());
+	}
+	printf("    %s : %.3f ns, worst %.3f ms\n", name, static_cast<double>(total.ElapsedNs()) / static_cast<double>(count), static_cast<double>(worst) / 1'000'000.0);
+}
+
+BENCHMARK("Containers/HashMapInsertLatency")
+{
+	constexpr U64 N = 20'000'000;
+	BenchInsertLatency<HashMap<U64, U64>>("HashMap - Insert", N);
+	BenchInsertLatency<SegmentedHashMap<U64, U64>>("SegmentedHashMap - Insert", N);
+	BenchInsertLatency<IncrementalHashMap<U64, U64>>("IncrementalHashMap - Insert", N);
+}
+
+BENCHMARK("Containers/ConcurrentHashMap")
+{
+	constexpr U32 NumThreads = 8;
+	constexpr U32 OpsPerThread = 1'000'000;
+	constexpr U32 KeyRange = 1 << 16;
+
+	ConcurrentHashMap<U64, U64> concurrentMap;
+	HashMap<U64, U64> lockedMap;
+	std::shared_mutex globalMutex;
+	for (U64 i = 0; i < KeyRange; i += 2)
+	{
+		concurrentMap.Insert(i, i);
+		lockedMap.Insert(i, i);
+	}
+
+	const auto concurrentFind = [&](U64 key) { return concurrentMap.Contains(key) ? 1llu : 0llu; };
+	const auto concurrentInsert = [&](U64 key) { concurrentMap.InsertOrAssign(key, key); };
+	const auto lockedFind = [&](U64 key) {
+		std::shared_lock lock(globalMutex);
+		return lockedMap.Contains(key) ? 1llu : 0llu;
+	};
+	const auto lockedInsert = [&](U64 key) {
+		std::unique_lock lock(globalMutex);
+		lockedMap.InsertOrAssign(key, key);
+	};
+
+	U64 total = 0;
+	BENCH_LOOP("ConcurrentHashMap - 95% reads", 1, NumThreads * OpsPerThread, {
+		total += RunMapWorkload(NumThreads, OpsPerThread, KeyRange, 5, concurrentFind, concurrentInsert);
+	});
+	BENCH_LOOP("HashMap + global shared_mutex - 95% reads", 1, NumThreads * OpsPerThread, {
+		total += RunMapWorkload(NumThreads, OpsPerThread, KeyRange, 5, lockedFind, lockedInsert);
+	});
+	BENCH_LOOP("ConcurrentHashMap - 50% writes", 1, NumThreads * OpsPerThread, {
+		total += RunMapWorkload(NumThreads, OpsPerThread, KeyRange, 50, concurrentFind, concurrentInsert);
+	});
+	BENCH_LOOP("HashMap + global shared_mutex - 50% writes", 1, NumThreads * OpsPerThread, {
+		total += RunMapWorkload(NumThreads, OpsPerThread, KeyRange, 50, lockedFind, lockedInsert);
+	});
+	printf("    Total: %llu\n", total);
+}
+
+// Skewed keys in [0, range), small keys are much more frequent
+static Vector<U32> MakeSkewedKeys(U32 count, U32 range)
+{
+	Vector<U32> keys;
+	keys.Reserve(count);
+	U64 state = 1;
+	for (U32 i = 0; i < count; i++)
+	{
+		const U64 r = (NextRandom(state) >> 33llu) % range;
+		keys.PushBack(static_cast<U32>(r * r / range));
+	}
+	return keys;
+}
+
+template<typename CacheT>
+static void BenchCache(const char* name, CacheT& cache, const Vector<U32>& keys)
+{
+	BENCH_LOOP(name, 1, keys.Size(), {
+		for (const U32 key : keys)
+		{
+			if (cache.Get(key) == nullptr)
+				cache.Put(key, key);
+		}
+	});
+
+	const CacheStats stats = cache.GetStats();
+	printf("    Hit rate: %.2f%%\n", 100.0 * static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses));
+}
+
+BENCHMARK("Containers/LruCache")
+{
+	constexpr U32 Capacity = 100'000;
+	const Vector<U32> keys = MakeSkewedKeys(10'000'000, 1'000'000);
+
+	LruCache<U32, U32> lru(Capacity);
+	BenchCache("LruCache - Get/Put", lru, keys);
+
+	ClockCache<U32, U32> clock(Capacity);
+	BenchCache("ClockCache - Get/Put", clock, keys);
+
+	constexpr U32 NumThreads = 8;
+	ConcurrentLruCache<U32, U32> concurrent(Capacity);
+	BENCH_LOOP("ConcurrentLruCache - Get/Put 8 threads", 1, keys.Size() * NumThreads, {
+		Vector<std::thread> threads;
+		for (U32 ti = 0; ti < NumThreads; ti++)
+		{
+			threads.EmplaceBack([&] {
+				for (const U32 key : keys)
+				{
+					if (!concurrent.Get(key).has_value())
+						concurrent.Put(key, key);
+				}
+			});
+		}
+		for (auto& t : threads)
+			t.join();
+	});
+}
+
+template<typename MapT>
+static U64 SumFlatMapLookups(const MapT& map, const Vector<U32>& keys)
+{
+	U64 total = 0;
+	for (const U32 key : keys)
+	{
+		const U32* value = map.TryFind(key);
+		if (value != nullptr)
+			total += *value;
+	}
+	return total;
+}
+
+static U64 SumHashMapLookups(const HashMap<U32, U32>& map, const Vector<U32>& keys)
+{
+	U64 total = 0;
+	for (const U32 key : keys)
+	{
+		const auto found = map.Find(key);
+		if (found != map.End())
+			total += found->second;
+	}
+	return total;
+}
+
+static void BenchSortedLookups(U32 size)
+{
+	constexpr U32 NumLookups = 1'000'000;
+	printf("  %u items\n", size);
+
+	Vector<U32> keys;
+	Vector<U32> values;
+	HashMap<U32, U32> hashMap;
+	hashMap.Reserve(size);
+	for (U32 i = 0; i < size; i++)
+	{
+		keys.PushBack(i * 2);
+		values.PushBack(i);
+		hashMap.Insert(i * 2, i);
+	}
+	FlatMap<U32, U32> flatMap = FlatMap<U32, U32>::BulkBuild(std::move(keys), std::move(values));
+
+	Vector<U32> lookups;
+	lookups.Reserve(NumLookups);
+	U64 state = 1;
+	for (U32 i = 0; i < NumLookups; i++)
+		lookups.PushBack(static_cast<U32>((NextRandom(state) >> 33llu) % (size * 2))); // Half of the lookups miss
+
+	U64 total = 0;
+	BENCH_LOOP("FlatMap - TryFind (branchless binary search)", 10, NumLookups, {
+		total += SumFlatMapLookups(flatMap, lookups);
+	});
+
+	flatMap.BuildEytzingerIndex();
+	BENCH_LOOP("FlatMap - TryFind (Eytzinger index)", 10, NumLookups, {
+		total += SumFlatMapLookups(flatMap, lookups);
+	});
+
+	BENCH_LOOP("HashMap - Find", 10, NumLookups, {
+		total += SumHashMapLookups(hashMap, lookups);
+	});
+	printf("    Total: %llu\n", total);
+}
+
+BENCHMARK("Containers/FlatMap")
+{
+	BenchSortedLookups(64);
+	BenchSortedLookups(100'000);
+	BenchSortedLookups(10'000'000);
+}
+
+static Vector<U32> MakeRandomKeys(U32 count, U32 range)
+{
+	Vector<U32> keys;
+	keys.Reserve(count);
+	U64 state = 1;
+	for (U32 i = 0; i < count; i++)
+		keys.PushBack(static_cast<U32>((NextRandom(state) >> 33llu) % range));
+	return keys;
+}
+
+template<typename MapT>
+static U64 SumOrderedRange(MapT& map, U32 first, U32 last)
+{
+	U64 total = 0;
+	for (auto it = map.lower_bound(first); it != map.end() && it->first < last; ++it)
+		total += it->second;
+	return total;
+}
+
+static U64 SumBTreeRange(const BTreeMap<U32, U32>& map, U32 first, U32 last)
+{
+	U64 total = 0;
+	for (auto [key, value] : map.Range(first, last))
+		total += value;
+	return total;
+}
+
+BENCHMARK("Containers/BTreeMap")
+{
+	constexpr U32 N = 1'000'000;
+	const Vector<U32> keys = MakeRandomKeys(N, N * 4);
+
+	U64 total = 0;
+	{
+		BTreeMap<U32, U32> map;
+		BENCH_LOOP("BTreeMap - Insert", 1, N, {
+			map.Clear();
+			for (const U32 key : keys)
+				map.Insert(key, key);
+		});
+		BENCH_LOOP("BTreeMap - Find", 10, N, {
+			for (const U32 key : keys)
+				total += map.Find(key).GetValue();
+		});
+		BENCH_LOOP("BTreeMap - Range(1000 keys)", 100, 1, {
+			total += SumBTreeRange(map, N, N + 1'000);
+		});
+		BENCH_LOOP("BTreeMap - Iterate", 10, map.Size(), {
+			for (auto it = map.Begin(); it != map.End(); ++it)
+				total += it.GetValue();
+		});
+	}
+	{
+		std::map<U32, U32> map;
+		BENCH_LOOP("std::map - Insert", 1, N, {
+			map.clear();
+			for (const U32 key : keys)
+				map.emplace(key, key);
+		});
+		BENCH_LOOP("std::map - Find", 10, N, {
+			for (const U32 key : keys)
+				total += map.find(key)->second;
+		});
+		BENCH_LOOP("std::map - Range(1000 keys)", 100, 1, {
+			total += SumOrderedRange(map, N, N + 1'000);
+		});
+		BENCH_LOOP("std::map - Iterate", 10, map.size(), {
+			for (const auto& item : map)
+				total += item.second;
+		});
+	}
+	printf("    Total: %llu\n", total);
+}
+
+struct BenchParticle
+{
+	float position[3];
+	float velocity[3];
+};
+
+static U64 SumSlotMapLookups(const SlotMap<BenchParticle>& map, const Vector<SlotHandle>& handles)
+{
+	U64 total = 0;
+	for (const SlotHandle handle : handles)
+	{
+		const BenchParticle* particle = map.TryFind(handle);
+		if (particle != nullptr)
+			total += static_cast<U64>(particle->position[0]);
+	}
+	return total;
+}
+
+static U64 SumHashMapLookups(const HashMap<U64, BenchParticle>& map, const Vector<U64>& ids)
+{
+	U64 total = 0;
+	for (const U64 id : ids)
+	{
+		const auto found = map.Find(id);
+		if (found != map.End())
+			total += static_cast<U64>(found->second.position[0]);
+	}
+	return total;
+}
+
+BENCHMARK("Containers/SlotMap")
+{
+	constexpr U32 N = 1'000'000;
+	const Vector<U32> order = MakeRandomKeys(N, N);
+
+	U64 total = 0;
+	{
+		SlotMap<BenchParticle> map;
+		Vector<SlotHandle> handles;
+		handles.Resize(N);
+		BENCH_LOOP("SlotMap - Insert", 1, N, {
+			for (U32 i = 0; i < N; i++)
+				handles[i] = map.Insert(BenchParticle{ { static_cast<float>(i) } });
+		});
+
+		Vector<SlotHandle> lookups;
+		for (const U32 i : order)
+			lookups.PushBack(handles[i]);
+		BENCH_LOOP("SlotMap - Random lookups", 10, N, {
+			total += SumSlotMapLookups(map, lookups);
+		});
+		BENCH_LOOP("SlotMap - Iterate", 10, N, {
+			for (const BenchParticle& particle : map)
+				total += static_cast<U64>(particle.position[0]);
+		});
+		BENCH_LOOP("SlotMap - Erase", 1, N, {
+			for (const SlotHandle handle : lookups)
+				map.Erase(handle);
+		});
+	}
+	{
+		HashMap<U64, BenchParticle> map;
+		BENCH_LOOP("HashMap<id> - Insert", 1, N, {
+			for (U32 i = 0; i < N; i++)
+				map.Insert(i, BenchParticle{ { static_cast<float>(i) } });
+		});
+
+		Vector<U64> lookups;
+		for (const U32 i : order)
+			lookups.PushBack(i);
+		BENCH_LOOP("HashMap<id> - Random lookups", 10, N, {
+			total += SumHashMapLookups(map, lookups);
+		});
+		BENCH_LOOP("HashMap<id> - Iterate", 10, N, {
+			for (const auto& item : map)
+				total += static_cast<U64>(item.second.position[0]);
+		});
+		BENCH_LOOP("HashMap<id> - Erase", 1, N, {
+			for (const U64 id : lookups)
+				map.Erase(id);
+		});
+	}
+	printf("    Total: %llu\n", total);
+}
+
+static U64 SumSparseSetLookups(const SparseSet<U32>& set, const Vector<U32>& keys)
+{
+	U64 total = 0;
+	for (const U32 key : keys)
+	{
+		const U32* value = set.TryFind(key);
+		if (value != nullptr)
+			total += *value;
+	}
+	return total;
+}
+
+static U64 SumSparseSetIntersection(SparseSet<U32>& a, SparseSet<U32>& b)
+{
+	U64 total = 0;
+	ForEachIntersection([&](U32, U32& valueA, U32& valueB) { total += valueA + valueB; }, a, b);
+	return total;
+}
+
+static U64 SumHashMapIntersection(const HashMap<U32, U32>& a, const HashMap<U32, U32>& b)
+{
+	const HashMap<U32, U32>& smallest = a.Size() < b.Size() ? a : b;
+	const HashMap<U32, U32>& other = a.Size() < b.Size() ? b : a;
+	U64 total = 0;
+	for (const auto& [key, value] : smallest)
+	{
+		const auto found = other.Find(key);
+		if (found != other.End())
+			total += value + found->second;
+	}
+	return total;
+}
+
+BENCHMARK("Containers/SparseSet")
+{
+	// Entity-like ids, 1M of them spread over 2^24
+	constexpr U32 N = 1'000'000;
+	const Vector<U32> keys = MakeRandomKeys(N, 1u << 24u);
+
+	U64 total = 0;
+	SparseSet<U32> set;
+	SparseSet<U32> everyTenth;
+	BENCH_LOOP("SparseSet - Insert", 1, N, {
+		for (const U32 key : keys)
+			set.Insert(key, key);
+	});
+	for (U32 i = 0; i < N; i += 10)
+		everyTenth.Insert(keys[i], i);
+	BENCH_LOOP("SparseSet - Find", 10, N, {
+		total += SumSparseSetLookups(set, keys);
+	});
+	BENCH_LOOP("SparseSet - Iterate", 10, set.Size(), {
+		for (const U32 value : set)
+			total += value;
+	});
+	BENCH_LOOP("SparseSet - Intersection", 10, everyTenth.Size(), {
+		total += SumSparseSetIntersection(set, everyTenth);
+	});
+
+	HashMap<U32, U32> map;
+	HashMap<U32, U32> mapEveryTenth;
+	BENCH_LOOP("HashMap - Insert", 1, N, {
+		for (const U32 key : keys)
+			map.Insert(key, key);
+	});
+	for (U32 i = 0; i < N; i += 10)
+		mapEveryTenth.Insert(keys[i], i);
+	BENCH_LOOP("HashMap - Find", 10, N, {
+		total += SumHashMapLookups(map, keys);
+	});
+	BENCH_LOOP("HashMap - Iterate", 10, map.Size(), {
+		for (const auto& item : map)
+			total += item.second;
+	});
+	BENCH_LOOP("HashMap - Intersection", 10, mapEveryTenth.Size(), {
+		total += SumHashMapIntersection(map, mapEveryTenth);
+	});
+	printf("    Total: %llu\n", total);
+}
+
+static U64 CountStdVectorBoolAnd(std::vector<bool>& a, const std::vector<bool>& b)
+{
+	U64 count = 0;
+	for (size_t i = 0; i < a.size(); i++)
+	{
+		a[i] = a[i] && b[i];
+		count += a[i] ? 1 : 0;
+	}
+	return count;
+}
+
+BENCHMARK("Containers/BitVector")
+{
+	// Filtering masks of 100M rows
+	constexpr U64 N = 100'000'000;
+	BitVector a(N);
+	BitVector b(N);
+	std::vector<bool> stdA(N);
+	std::vector<bool> stdB(N);
+	U64 state = 1;
+	for (U64 i = 0; i < N; i++)
+	{
+		const U64 random = NextRandom(state);
+		if ((random >> 60llu) < 12)
+		{
+			a.Set(i);
+			stdA[i] = true;
+		}
+		if ((random >> 56llu) % 2 == 0)
+		{
+			b.Set(i);
+			stdB[i] = true;
+		}
+	}
+
+	U64 total = 0;
+	BENCH_LOOP("BitVector - And + PopCount", 10, N, {
+		a.And(b);
+		total += a.PopCount();
+	});
+	BENCH_LOOP("std::vector<bool> - And + count", 10, N, {
+		total += CountStdVectorBoolAnd(stdA, stdB);
+	});
+	BENCH_LOOP("BitVector - Iterate set bits", 10, N, {
+		for (const U64 index : b.SetBits())
+			total += index;
+	});
+
+	BitRankSelect rankSelect;
+	BENCH_LOOP("BitRankSelect - Build", 10, N, {
+		rankSelect.Build(b);
+	});
+	BENCH_LOOP("BitRankSelect - Rank", 1, 1'000'000, {
+		for (U64 i = 0; i < 1'000'000; i++)
+			total += rankSelect.Rank((i * 7'919) % N);
+	});
+	BENCH_LOOP("BitRankSelect - Select", 1, 1'000'000, {
+		for (U64 i = 0; i < 1'000'000; i++)
+			total += rankSelect.Select((i * 7'919) % rankSelect.PopCount());
+	});
+	printf("    Total: %llu\n", total);
+}
+
+static Vector<U64> MakeRandomU64Keys(U32 count, U64 seed)
+{
+	Vector<U64> keys;
+	keys.Reserve(count);
+	U64 state = seed;
+	for (U32 i = 0; i < count; i++)
+	{
+		const U64 random = NextRandom(state);
+		keys.PushBack(random ^ (random >> 29llu));
+	}
+	return keys;
+}
+
+template<typename Filter>
+static U64 CountFilterHits(const Filter& filter, const Vector<U64>& keys)
+{
+	U64 hits = 0;
+	for (const U64 key : keys)
+		hits += filter.Contains(key) ? 1 : 0;
+	return hits;
+}
+
+template<typename Filter>
+static U64 SumFilteredLookups(const Filter& filter, const HashMap<U64, U64>& map, const Vector<U64>& keys)
+{
+	U64 total = 0;
+	for (const U64 key : keys)
+	{
+		if (!filter.Contains(key))
+			continue;
+		const auto it = map.Find(key);
+		if (it != map.End())
+			total += it->second;
+	}
+	return total;
+}
+
+static U64 SumHashMapLookups(const HashMap<U64, U64>& map, const Vector<U64>& keys)
+{
+	U64 total = 0;
+	for (const U64 key : keys)
+	{
+		const auto it = map.Find(key);
+		if (it != map.End())
+			total += it->second;
+	}
+	return total;
+}
+
+BENCHMARK("Containers/Filters")
+{
+	// Pre-check of lookups in a big map where 90% of the keys are absent
+	constexpr U32 N = 10'000'000;
+	const Vector<U64> keys = MakeRandomU64Keys(N, 1);
+	HashMap<U64, U64> map;
+	map.Reserve(N);
+	for (const U64 key : keys)
+		map.Insert(key, key);
+
+	Vector<U64> lookups = MakeRandomU64Keys(N, 2);
+	for (U32 i = 0; i < N; i += 10)
+		lookups[i] = keys[i];
+
+	BloomFilter<U64> bloom;
+	BENCH_LOOP("BloomFilter - Build", 1, N, {
+		bloom.Reset(N);
+		for (const U64 key : keys)
+			bloom.Insert(key);
+	});
+	BloomFilter<U64> bloom16(N, 16);
+	for (const U64 key : keys)
+		bloom16.Insert(key);
+
+	XorFilter<U64> xorFilter;
+	BENCH_LOOP("XorFilter - Build", 1, N, {
+		xorFilter.Build(keys);
+	});
+
+	const Vector<U64> absent = MakeRandomU64Keys(N, 3);
+	printf("    BloomFilter 10 bits/key: %.3f%% false positives, %llu bytes\n", 100.0 * static_cast<double>(CountFilterHits(bloom, absent)) / N, bloom.SizeInBytes());
+	printf("    BloomFilter 16 bits/key: %.3f%% false positives, %llu bytes\n", 100.0 * static_cast<double>(CountFilterHits(bloom16, absent)) / N, bloom16.SizeInBytes());
+	printf("    XorFilter: %.3f%% false positives, %llu bytes\n", 100.0 * static_cast<double>(CountFilterHits(xorFilter, absent)) / N, xorFilter.SizeInBytes());
+
+	U64 total = 0;
+	BENCH_LOOP("BloomFilter - Contains", 10, N, {
+		total += CountFilterHits(bloom, lookups);
+	});
+	BENCH_LOOP("XorFilter - Contains", 10, N, {
+		total += CountFilterHits(xorFilter, lookups);
+	});
+	BENCH_LOOP("HashMap - Find", 10, N, {
+		total += SumHashMapLookups(map, lookups);
+	});
+	BENCH_LOOP("BloomFilter + HashMap - Find", 10, N, {
+		total += SumFilteredLookups(bloom, map, lookups);
+	});
+	BENCH_LOOP("XorFilter + HashMap - Find", 10, N, {
+		total += SumFilteredLookups(xorFilter, map, lookups);
+	});
+	printf("    Total: %llu\n", total);
+}
+
+template<typename Queue>
+static U64 PushPopAll(Queue& queue, const Vector<U32>& values)
+{
+	for (const U32 value : values)
+		queue.Push(value);
+
+	U64 total = 0;
+	while (!queue.IsEmpty())
+		total += queue.Pop();
+	return total;
+}
+
+static U64 PushPopAllStd(std::priority_queue<U32>& queue, const Vector<U32>& values)
+{
+	for (const U32 value : values)
+		queue.push(value);
+
+	U64 total = 0;
+	while (!queue.empty())
+	{
+		total += queue.top();
+		queue.pop();
+	}
+	return total;
+}
+
+struct BenchGraph
+{
+	Vector<U32> firstEdge; // Edges of node i are in [firstEdge[i], firstEdge[i + 1])
+	Vector<U32> targets;
+	Vector<U32> weights;
+};
+
+static BenchGraph MakeRandomGraph(U32 numNodes, U32 edgesPerNode)
+{
+	BenchGraph graph;
+	const Vector<U32> targets = MakeRandomKeys(numNodes * edgesPerNode, numNodes);
+	const Vector<U64> weights = MakeRandomU64Keys(numNodes * edgesPerNode, 4);
+	for (U32 node = 0; node < numNodes; node++)
+	{
+		graph.firstEdge.PushBack(graph.targets.Size());
+		for (U32 i = 0; i < edgesPerNode; i++)
+		{
+			// Link to the next node so everything is reachable
+			graph.targets.PushBack(i == 0 ? (node + 1) % numNodes : targets[node * edgesPerNode + i]);
+			graph.weights.PushBack(static_cast<U32>(weights[node * edgesPerNode + i] % 1000) + 1);
+		}
+	}
+	graph.firstEdge.PushBack(graph.targets.Size());
+	return graph;
+}
+
+// Shortest distances from node 0, each node is in the queue once and its distance decreased in place
+static U64 SumDistancesIndexed(const BenchGraph& graph)
+{
+	using Item = std::pair<U64, U32>; // Distance and node
+	const U32 numNodes = graph.firstEdge.Size() - 1;
+	Vector<U64> distances;
+	distances.Resize(numNodes, Math::MaxValue<U64>());
+	Vector<SlotHandle> handles;
+	handles.Resize(numNodes);
+	IndexedPriorityQueue<Item, DefaultAllocator, std::greater<>> queue;
+
+	distances[0] = 0;
+	handles[0] = queue.Push(Item(0, 0));
+	while (!queue.IsEmpty())
+	{
+		const Item item = queue.Pop();
+		for (U32 edge = graph.firstEdge[item.second]; edge < graph.firstEdge[item.second + 1]; edge++)
+		{
+			const U32 target = graph.targets[edge];
+			const U64 distance = item.first + graph.weights[edge];
+			if (distance >= distances[target])
+				continue;
+
+			if (distances[target] == Math::MaxValue<U64>())
+				handles[target] = queue.Push(Item(distance, target));
+			else
+				queue.DecreaseKey(handles[target], Item(distance, target));
+			distances[target] = distance;
+		}
+	}
+
+	U64 total = 0;
+	for (const U64 distance : distances)
+		total += distance;
+	return total;
+}
+
+// Same with std::priority_queue, which can't decrease keys so the outdated entries are skipped when popped
+static U64 SumDistancesStd(const BenchGraph& graph)
+{
+	using Item = std::pair<U64, U32>;
+	const U32 numNodes = graph.firstEdge.Size() - 1;
+	Vector<U64> distances;
+	distances.Resize(numNodes, Math::MaxValue<U64>());
+	std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+
+	distances[0] = 0;
+	queue.push(Item(0, 0));
+	while (!queue.empty())
+	{
+		const Item item = queue.top();
+		queue.pop();
+		if (item.first != distances[item.second])
+			continue;
+
+		for (U32 edge = graph.firstEdge[item.second]; edge < graph.firstEdge[item.second + 1]; edge++)
+		{
+			const U32 target = graph.targets[edge];
+			const U64 distance = item.first + graph.weights[edge];
+			if (distance >= distances[target])
+				continue;
+
+			queue.push(Item(distance, target));
+			distances[target] = distance;
+		}
+	}
+
+	U64 total = 0;
+	for (const U64 distance : distances)
+		total += distance;
+	return total;
+}
+
+BENCHMARK("Containers/PriorityQueue")
+{
+	constexpr U32 N = 1'000'000;
+	const Vector<U32> values = MakeRandomKeys(N, Math::MaxValue<U32>());
+
+	U64 total = 0;
+	PriorityQueue<U32> queue;
+	PriorityQueue<U32, DefaultAllocator, std::less<>, 2> binaryQueue;
+	std::priority_queue<U32> stdQueue;
+	BENCH_LOOP("PriorityQueue - Push + Pop", 10, N, {
+		total += PushPopAll(queue, values);
+	});
+	BENCH_LOOP("PriorityQueue (binary) - Push + Pop", 10, N, {
+		total += PushPopAll(binaryQueue, values);
+	});
+	BENCH_LOOP("std::priority_queue - Push + Pop", 10, N, {
+		total += PushPopAllStd(stdQueue, values);
+	});
+
+	BENCH_LOOP("PriorityQueue - Push one by one", 10, N, {
+		queue.Clear();
+		for (const U32 value : values)
+			queue.Push(value);
+	});
+	BENCH_LOOP("PriorityQueue - PushN", 10, N, {
+		queue.Clear();
+		queue.PushN(values);
+	});
+
+	const BenchGraph graph = MakeRandomGraph(N, 8);
+	BENCH_LOOP("IndexedPriorityQueue - Dijkstra with DecreaseKey", 5, N, {
+		total += SumDistancesIndexed(graph);
+	});
+	BENCH_LOOP("std::priority_queue - Dijkstra with lazy deletion", 5, N, {
+		total += SumDistancesStd(graph);
+	});
+	printf("    Total: %llu\n", total);
+}
+
+static void ScheduleTimers(TimerWheel<>& wheel, const Vector<U64>& deadlines, Vector<TimerHandle>& handles, U64& fired)
+{
+	for (const U64 deadline : deadlines)
+		handles.PushBack(wheel.Schedule(deadline, [&fired] { fired++; }));
+}
+
+// Cancels 9 timers out of 10, most timeouts are cancelled because the request completed
+static void CancelTimers(TimerWheel<>& wheel, const Vector<TimerHandle>& handles)
+{
+	for (U32 i = 0; i < handles.Size(); i++)
+	{
+		if (i % 10 != 0)
+			wheel.Cancel(handles[i]);
+	}
+}
+
+static U64 AdvanceTimers(TimerWheel<>& wheel, U64 endNs, U64 stepNs)
+{
+	U64 fired = 0;
+	for (U64 now = 0; now <= endNs; now += stepNs)
+		fired += wheel.Advance(now);
+	return fired;
+}
+
+using StdTimerSet = std::set<std::pair<U64, U32>>; // Deadline and timer index, the previous O(log n) approach
+
+static void ScheduleTimers(StdTimerSet& timers, const Vector<U64>& deadlines)
+{
+	for (U32 i = 0; i < deadlines.Size(); i++)
+		timers.insert(std::pair<U64, U32>(deadlines[i], i));
+}
+
+static void CancelTimers(StdTimerSet& timers, const Vector<U64>& deadlines)
+{
+	for (U32 i = 0; i < deadlines.Size(); i++)
+	{
+		if (i % 10 != 0)
+			timers.erase(std::pair<U64, U32>(deadlines[i], i));
+	}
+}
+
+static U64 AdvanceTimers(StdTimerSet& timers, U64 endNs, U64 stepNs)
+{
+	U64 fired = 0;
+	for (U64 now = 0; now <= endNs; now += stepNs)
+	{
+		while (!timers.empty() && timers.begin()->first <= now)
+		{
+			timers.erase(timers.begin());
+			fired++;
+		}
+	}
+	return fired;
+}
+
+BENCHMARK("Containers/TimerWheel")
+{
+	// 10M timeouts spread over 30s, advanced every millisecond
+	constexpr U32 N = 10'000'000;
+	constexpr U64 Ms = 1'000'000;
+	constexpr U64 Duration = 30'000 * Ms;
+	const Vector<U64> random = MakeRandomU64Keys(N, 5);
+	Vector<U64> deadlines;
+	deadlines.Reserve(N);
+	for (const U64 value : random)
+		deadlines.PushBack(value % Duration);
+
+	U64 total = 0;
+	{
+		TimerWheel<> wheel(Ms);
+		Vector<TimerHandle> handles;
+		handles.Reserve(N);
+		BENCH_LOOP("TimerWheel - Schedule", 1, N, {
+			ScheduleTimers(wheel, deadlines, handles, total);
+		});
+		BENCH_LOOP("TimerWheel - Cancel", 1, N, {
+			CancelTimers(wheel, handles);
+		});
+		BENCH_LOOP("TimerWheel - Advance", 1, N / 10, {
+			total += AdvanceTimers(wheel, Duration, Ms);
+		});
+	}
+	{
+		StdTimerSet timers;
+		BENCH_LOOP("std::set - Schedule", 1, N, {
+			ScheduleTimers(timers, deadlines);
+		});
+		BENCH_LOOP("std::set - Cancel", 1, N, {
+			CancelTimers(timers, deadlines);
+		});
+		BENCH_LOOP("std::set - Advance", 1, N / 10, {
+			total += AdvanceTimers(timers, Duration, Ms);
+		});
+	}
+	printf("    Total: %llu\n", total);
+}
+
+BENCHMARK("Containers/ConstexprMap")
+{
+	constexpr auto keywords = MakeConstexprMap<StringView, U32>({
+		{ "GET", 0 }, { "HEAD", 1 }, { "POST", 2 }, { "PUT", 3 }, { "DELETE", 4 }, { "CONNECT", 5 }, { "OPTIONS", 6 },
+		{ "TRACE", 7 }, { "PATCH", 8 }, { "Host", 9 }, { "Accept", 10 }, { "Content-Type", 11 }, { "Content-Length", 12 },
+		{ "Connection", 13 }, { "User-Agent", 14 }, { "Cookie", 15 },
+	});
+
+	StringHashMap<U32> map;
+	for (const auto& [key, value] : keywords)
+		map.Insert(key, value);
+
+	Vector<StringView> lookups;
+	for (U32 i = 0; i < 1024; i++)
+		lookups.PushBack(keywords.Begin()[rand() % keywords.Size()].first);
+
+	U64 total = 0;
+	BENCH_LOOP("ConstexprMap - Find", 1'000, lookups.Size(), {
+		for (StringView key : lookups)
+			total += keywords.Find(key)->second;
+	});
+	BENCH_LOOP("StringHashMap - Find", 1'000, lookups.Size(), {
+		for (StringView key : lookups)
+			total += map.Find(key)->second;
+	});
+	printf("    Total: %llu\n", total);
+}
+
 BENCHMARK("Containers/Deque")
 {
 	{
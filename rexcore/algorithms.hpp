@@ -1,6 +1,8 @@
 #pragma once
+#include <rexcore/core.hpp>
 
 #include <algorithm>
+#include <functional>
 
 namespace RexCore
 {
@@ -16,6 +18,42 @@ namespace RexCore
 		std::sort(array.Begin(), array.End(), std::forward<PredT>(pred));
 	}
 
+	// Index of the first element of the sorted range that is not ordered before value, size if there is none.
+	// Branchless binary search, the comparison only selects the next base so the compiler emits a conditional move
+	// and the loop runs log2(size) times whatever the data, instead of mispredicting half of the branches.
+	template<typename T, typename K, typename Compare = std::less<>>
+	[[nodiscard]] constexpr U64 LowerBound(const T* data, U64 size, const K& value, Compare comp = {})
+	{
+		if (size == 0)
+			return 0;
+
+		const T* base = data;
+		while (size > 1)
+		{
+			const U64 half = size / 2;
+			base = comp(base[half], value) ? base + half : base;
+			size -= half;
+		}
+		return static_cast<U64>(base - data) + (comp(*base, value) ? 1 : 0);
+	}
+
+	// Index of the first element of the sorted range that is ordered after value, size if there is none
+	template<typename T, typename K, typename Compare = std::less<>>
+	[[nodiscard]] constexpr U64 UpperBound(const T* data, U64 size, const K& value, Compare comp = {})
+	{
+		if (size == 0)
+			return 0;
+
+		const T* base = data;
+		while (size > 1)
+		{
+			const U64 half = size / 2;
+			base = comp(value, base[half]) ? base : base + half;
+			size -= half;
+		}
+		return static_cast<U64>(base - data) + (comp(value, *base) ? 0 : 1);
+	}
+
 	// Predicate : void(const T& elem, ResultT& result)
 	template<typename ResultT, typename ArrayT, typename PredT>
 	constexpr ResultT Reduce(ArrayT& array, PredT&& pred)
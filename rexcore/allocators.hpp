@@ -10,6 +10,7 @@
 #include <bit>
 #include <source_location>
 #include <functional>
+#include <utility>
 
 namespace RexCore
 {
@@ -315,21 +316,34 @@ namespace RexCore
 		static_assert(Alignment % alignof(void*) == 0, "Alignment must be a multiple of pointer alignment");
 
 		REX_CORE_NO_COPY(PoolAllocatorBase);
-		REX_CORE_DEFAULT_MOVE(PoolAllocatorBase);
 
 		constexpr explicit PoolAllocatorBase(AllocatorRef<ChunkAllocator> allocator = AllocatorRefDefaultArg<ChunkAllocator>()) noexcept
 			: m_allocator(allocator)
 		{}
 
+		// The free list is taken over, the moved-from pool is left empty
+		constexpr PoolAllocatorBase(PoolAllocatorBase&& other) noexcept
+			: m_allocator(other.m_allocator), m_freeList(std::exchange(other.m_freeList, nullptr))
+		{}
+
+		// Both pools must use the same chunk allocator if it is not stateless
+		constexpr PoolAllocatorBase& operator=(PoolAllocatorBase&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			ReleaseFreeList();
+			if constexpr (std::is_empty_v<ChunkAllocator>)
+				m_allocator = other.m_allocator;
+			else
+				REX_CORE_ASSERT(&m_allocator == &other.m_allocator);
+			m_freeList = std::exchange(other.m_freeList, nullptr);
+			return *this;
+		}
+
 		constexpr ~PoolAllocatorBase() 
 		{
-			Chunk* chunk = m_freeList;
-			while (chunk != nullptr)
-			{
-				Chunk* next = chunk->nextFree;
-				m_allocator.FreeUntracked(chunk, sizeof(Chunk));
-				chunk = next;
-			}
+			ReleaseFreeList();
 		}
 
 		// [size] must always be ChunkSize
@@ -374,6 +388,18 @@ namespace RexCore
 			};
 		};
 
+		constexpr void ReleaseFreeList()
+		{
+			Chunk* chunk = m_freeList;
+			while (chunk != nullptr)
+			{
+				Chunk* next = chunk->nextFree;
+				m_allocator.FreeUntracked(chunk, sizeof(Chunk));
+				chunk = next;
+			}
+			m_freeList = nullptr;
+		}
+
 		[[no_unique_address]] AllocatorRef<ChunkAllocator> m_allocator;
 		Chunk* m_freeList = nullptr;
 	};
@@ -0,0 +1,528 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/algorithms.hpp>
+#include <rexcore/iterators.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/simd.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/span.hpp>
+
+#include <bit>
+#include <utility>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace RexCore
+{
+	namespace Internal
+	{
+		enum class BitOp
+		{
+			And,
+			Or,
+			Xor,
+			AndNot,
+		};
+
+		template<BitOp Op>
+		[[nodiscard]] constexpr U64 ApplyBitOp(U64 a, U64 b)
+		{
+			if constexpr (Op == BitOp::And)
+				return a & b;
+			else if constexpr (Op == BitOp::Or)
+				return a | b;
+			else if constexpr (Op == BitOp::Xor)
+				return a ^ b;
+			else
+				return a & ~b;
+		}
+
+		// dest[i] = dest[i] Op src[i], 4 words at a time with AVX2
+		template<BitOp Op>
+		void CombineWords(U64* dest, const U64* src, U64 count)
+		{
+			U64 i = 0;
+#if defined(REX_CORE_AVX2)
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dest + i));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				__m256i result;
+				if constexpr (Op == BitOp::And)
+					result = _mm256_and_si256(a, b);
+				else if constexpr (Op == BitOp::Or)
+					result = _mm256_or_si256(a, b);
+				else if constexpr (Op == BitOp::Xor)
+					result = _mm256_xor_si256(a, b);
+				else
+					result = _mm256_andnot_si256(b, a);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), result);
+			}
+#endif
+			for (; i < count; i++)
+				dest[i] = ApplyBitOp<Op>(dest[i], src[i]);
+		}
+
+		// Number of set bits in the words. With AVX2 the bits of each nibble are counted with a shuffle lookup table
+		// and summed per 64 bits lane (Mula's algorithm), which is faster than one popcnt per word on big arrays.
+		[[nodiscard]] inline U64 PopCountWords(const U64* words, U64 count)
+		{
+			U64 total = 0;
+			U64 i = 0;
+#if defined(REX_CORE_AVX2)
+			const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+			const __m256i lowMask = _mm256_set1_epi8(0x0f);
+			__m256i sums = _mm256_setzero_si256();
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+				const __m256i low = _mm256_and_si256(block, lowMask);
+				const __m256i high = _mm256_and_si256(_mm256_srli_epi16(block, 4), lowMask);
+				const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+				sums = _mm256_add_epi64(sums, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+			}
+			total += static_cast<U64>(_mm256_extract_epi64(sums, 0)) + static_cast<U64>(_mm256_extract_epi64(sums, 1)) +
+				static_cast<U64>(_mm256_extract_epi64(sums, 2)) + static_cast<U64>(_mm256_extract_epi64(sums, 3));
+#endif
+			for (; i < count; i++)
+				total += static_cast<U64>(std::popcount(words[i]));
+			return total;
+		}
+
+		// Position of the set bit of word with the given rank, the word must have more than rank set bits
+		[[nodiscard]] inline U32 SelectInWord(U64 word, U32 rank)
+		{
+#if defined(__BMI2__)
+			return static_cast<U32>(std::countr_zero(_pdep_u64(1llu << rank, word)));
+#else
+			for (U32 i = 0; i < rank; i++)
+				word &= word - 1;
+			return static_cast<U32>(std::countr_zero(word));
+#endif
+		}
+
+		// Visits the set bits with tzcnt, clearing the lowest set bit of the current word at each step
+		class SetBitIterator
+		{
+		public:
+			SetBitIterator() noexcept = default;
+
+			SetBitIterator(const U64* words, U64 numWords, U64 wordIndex) noexcept
+				: m_words(words), m_numWords(numWords), m_wordIndex(wordIndex)
+			{
+				if (m_wordIndex < m_numWords)
+				{
+					m_current = m_words[m_wordIndex];
+					SkipEmptyWords();
+				}
+			}
+
+			[[nodiscard]] friend bool operator==(const SetBitIterator& lhs, const SetBitIterator& rhs)
+			{
+				return lhs.m_wordIndex == rhs.m_wordIndex && lhs.m_current == rhs.m_current;
+			}
+			[[nodiscard]] friend bool operator!=(const SetBitIterator& lhs, const SetBitIterator& rhs)
+			{
+				return !(lhs == rhs);
+			}
+
+			[[nodiscard]] U64 operator*() const
+			{
+				return m_wordIndex * 64 + static_cast<U64>(std::countr_zero(m_current));
+			}
+
+			SetBitIterator& operator++()
+			{
+				m_current &= m_current - 1;
+				SkipEmptyWords();
+				return *this;
+			}
+			SetBitIterator operator++(int)
+			{
+				SetBitIterator copy(*this);
+				++*this;
+				return copy;
+			}
+
+		private:
+			void SkipEmptyWords()
+			{
+				while (m_current == 0 && ++m_wordIndex < m_numWords)
+					m_current = m_words[m_wordIndex];
+			}
+
+		private:
+			const U64* m_words = nullptr;
+			U64 m_numWords = 0;
+			U64 m_wordIndex = 0;
+			U64 m_current = 0;
+		};
+
+		// Operations shared by BitVector and FixedBitSet
+		// ParentClass must implement :
+		// U64 Size() const, the number of bits
+		// U64 NumWords() const
+		// U64* Data() and const U64* Data() const, the bits past Size() in the last word are always 0
+		template<typename ParentClass>
+		class BitSetBase
+		{
+		public:
+			[[nodiscard]] constexpr bool IsEmpty() const { return Self().Size() == 0; }
+
+			[[nodiscard]] constexpr bool Test(U64 index) const
+			{
+				REX_CORE_ASSERT(index < Self().Size());
+				return (Self().Data()[index / 64] >> (index % 64)) & 1;
+			}
+
+			[[nodiscard]] constexpr bool operator[](U64 index) const { return Test(index); }
+
+			constexpr void Set(U64 index)
+			{
+				REX_CORE_ASSERT(index < Self().Size());
+				Self().Data()[index / 64] |= 1llu << (index % 64);
+			}
+
+			constexpr void Set(U64 index, bool value)
+			{
+				if (value)
+					Set(index);
+				else
+					Reset(index);
+			}
+
+			constexpr void Reset(U64 index)
+			{
+				REX_CORE_ASSERT(index < Self().Size());
+				Self().Data()[index / 64] &= ~(1llu << (index % 64));
+			}
+
+			constexpr void Flip(U64 index)
+			{
+				REX_CORE_ASSERT(index < Self().Size());
+				Self().Data()[index / 64] ^= 1llu << (index % 64);
+			}
+
+			constexpr void SetAll()
+			{
+				for (U64 i = 0; i < Self().NumWords(); i++)
+					Self().Data()[i] = ~0llu;
+				ClearUnusedBits();
+			}
+
+			constexpr void ResetAll()
+			{
+				for (U64 i = 0; i < Self().NumWords(); i++)
+					Self().Data()[i] = 0;
+			}
+
+			constexpr void FlipAll()
+			{
+				for (U64 i = 0; i < Self().NumWords(); i++)
+					Self().Data()[i] = ~Self().Data()[i];
+				ClearUnusedBits();
+			}
+
+			[[nodiscard]] U64 PopCount() const { return PopCountWords(Self().Data(), Self().NumWords()); }
+
+			[[nodiscard]] bool Any() const
+			{
+				for (U64 i = 0; i < Self().NumWords(); i++)
+				{
+					if (Self().Data()[i] != 0)
+						return true;
+				}
+				return false;
+			}
+
+			[[nodiscard]] bool None() const { return !Any(); }
+			[[nodiscard]] bool All() const { return PopCount() == Self().Size(); }
+
+			// Both sets must have the same size
+			template<typename Other>
+			ParentClass& And(const BitSetBase<Other>& other) { return Combine<BitOp::And>(other); }
+
+			template<typename Other>
+			ParentClass& Or(const BitSetBase<Other>& other) { return Combine<BitOp::Or>(other); }
+
+			template<typename Other>
+			ParentClass& Xor(const BitSetBase<Other>& other) { return Combine<BitOp::Xor>(other); }
+
+			// Clears the bits set in other
+			template<typename Other>
+			ParentClass& AndNot(const BitSetBase<Other>& other) { return Combine<BitOp::AndNot>(other); }
+
+			// Will return Size() if no bit is set
+			[[nodiscard]] U64 FindFirstSet() const { return FindSetFrom(0); }
+
+			// First set bit after index, will return Size() if there is none
+			[[nodiscard]] U64 FindNextSet(U64 index) const { return FindSetFrom(index + 1); }
+
+			// Indices of the set bits in increasing order : for (U64 index : bits.SetBits())
+			[[nodiscard]] Iter::ContainerView<SetBitIterator> SetBits() const
+			{
+				const U64 numWords = Self().NumWords();
+				return { SetBitIterator(Self().Data(), numWords, 0), SetBitIterator(Self().Data(), numWords, numWords) };
+			}
+
+			// Calls fn(U64 index) for each set bit in increasing order
+			template<typename Fn>
+			void ForEachSet(Fn&& fn) const
+			{
+				const U64* words = Self().Data();
+				for (U64 i = 0; i < Self().NumWords(); i++)
+				{
+					for (U64 word = words[i]; word != 0; word &= word - 1)
+						fn(i * 64 + static_cast<U64>(std::countr_zero(word)));
+				}
+			}
+
+			[[nodiscard]] Span<U64> GetWords() const
+			{
+				REX_CORE_ASSERT(Self().NumWords() <= Math::MaxValue<U32>());
+				return Span<U64>(Self().Data(), static_cast<U32>(Self().NumWords()));
+			}
+
+		protected:
+			constexpr void ClearUnusedBits()
+			{
+				const U64 usedBits = Self().Size() % 64;
+				if (usedBits != 0)
+					Self().Data()[Self().NumWords() - 1] &= (1llu << usedBits) - 1;
+			}
+
+		private:
+			[[nodiscard]] constexpr ParentClass& Self() { return static_cast<ParentClass&>(*this); }
+			[[nodiscard]] constexpr const ParentClass& Self() const { return static_cast<const ParentClass&>(*this); }
+
+			template<BitOp Op, typename Other>
+			ParentClass& Combine(const BitSetBase<Other>& other)
+			{
+				const Other& otherSet = static_cast<const Other&>(other);
+				REX_CORE_ASSERT(otherSet.Size() == Self().Size(), "Both bit sets must have the same size");
+				CombineWords<Op>(Self().Data(), otherSet.Data(), Self().NumWords());
+				return Self();
+			}
+
+			[[nodiscard]] U64 FindSetFrom(U64 index) const
+			{
+				const U64 size = Self().Size();
+				if (index >= size)
+					return size;
+
+				const U64* words = Self().Data();
+				U64 wordIndex = index / 64;
+				U64 word = words[wordIndex] & (~0llu << (index % 64));
+				while (word == 0)
+				{
+					if (++wordIndex == Self().NumWords())
+						return size;
+					word = words[wordIndex];
+				}
+				return wordIndex * 64 + static_cast<U64>(std::countr_zero(word));
+			}
+		};
+	}
+
+	// Resizable array of bits packed in 64 bits words
+	template<IAllocator Allocator = DefaultAllocator>
+	class BitVector : public Internal::BitSetBase<BitVector<Allocator>>
+	{
+	public:
+		REX_CORE_NO_COPY(BitVector);
+
+		explicit BitVector(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_words(allocator)
+		{}
+
+		explicit BitVector(U64 size, bool value = false, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_words(allocator)
+		{
+			Resize(size, value);
+		}
+
+		BitVector(BitVector&& other) noexcept
+			: m_words(std::move(other.m_words)), m_size(std::exchange(other.m_size, 0))
+		{}
+
+		BitVector& operator=(BitVector&& other) noexcept
+		{
+			m_words = std::move(other.m_words);
+			m_size = std::exchange(other.m_size, 0);
+			return *this;
+		}
+
+		[[nodiscard]] BitVector Clone() const
+		{
+			BitVector clone(m_words.GetAllocator());
+			clone.m_words = m_words.Clone();
+			clone.m_size = m_size;
+			return clone;
+		}
+
+		[[nodiscard]] U64 Size() const { return m_size; }
+		[[nodiscard]] U64 NumWords() const { return m_words.Size(); }
+		[[nodiscard]] U64* Data() { return m_words.Data(); }
+		[[nodiscard]] const U64* Data() const { return m_words.Data(); }
+
+		void Reserve(U64 size) { m_words.Reserve(static_cast<U32>(Math::CeilDiv<U64>(size, 64))); }
+
+		// The new bits are set to value
+		void Resize(U64 size, bool value = false)
+		{
+			const U64 oldSize = m_size;
+			m_words.Resize(static_cast<U32>(Math::CeilDiv<U64>(size, 64)));
+			m_size = size;
+
+			if (size > oldSize)
+			{
+				// Resize() doesn't clear the words that were already allocated, the bits past the old size are cleared first
+				const U64 firstNewWord = Math::CeilDiv<U64>(oldSize, 64);
+				if (oldSize % 64 != 0)
+				{
+					const U64 keptMask = (1llu << (oldSize % 64)) - 1;
+					m_words[static_cast<U32>(oldSize / 64)] = (m_words[static_cast<U32>(oldSize / 64)] & keptMask) | (value ? ~keptMask : 0);
+				}
+				for (U64 i = firstNewWord; i < m_words.Size(); i++)
+					m_words[static_cast<U32>(i)] = value ? ~0llu : 0;
+			}
+			this->ClearUnusedBits();
+		}
+
+		void PushBack(bool value)
+		{
+			if (m_size % 64 == 0)
+				m_words.EmplaceBack(0llu);
+			m_size++;
+			this->Set(m_size - 1, value);
+		}
+
+		void Clear()
+		{
+			m_words.Clear();
+			m_size = 0;
+		}
+
+		[[nodiscard]] AllocatorRef<Allocator> GetAllocator() const { return m_words.GetAllocator(); }
+
+	private:
+		Vector<U64, Allocator> m_words;
+		U64 m_size = 0;
+	};
+
+	// Fixed-size array of N bits stored inplace
+	template<U64 N>
+	class FixedBitSet : public Internal::BitSetBase<FixedBitSet<N>>
+	{
+	public:
+		static_assert(N > 0, "FixedBitSet must hold at least one bit");
+
+		constexpr FixedBitSet() noexcept = default;
+
+		[[nodiscard]] constexpr U64 Size() const { return N; }
+		[[nodiscard]] constexpr U64 NumWords() const { return WordCount; }
+		[[nodiscard]] constexpr U64* Data() { return m_words; }
+		[[nodiscard]] constexpr const U64* Data() const { return m_words; }
+
+		[[nodiscard]] friend constexpr bool operator==(const FixedBitSet& lhs, const FixedBitSet& rhs)
+		{
+			for (U64 i = 0; i < WordCount; i++)
+			{
+				if (lhs.m_words[i] != rhs.m_words[i])
+					return false;
+			}
+			return true;
+		}
+
+	private:
+		constexpr static U64 WordCount = Math::CeilDiv<U64>(N, 64);
+
+		U64 m_words[WordCount] = {};
+	};
+
+	// Rank (number of set bits before a position) and select (position of the nth set bit) queries over a BitVector or
+	// a FixedBitSet. The cumulative count of set bits is stored every 512 bits, a rank then counts at most 8 words and
+	// a select is a binary search over the counts followed by a scan of at most 8 words.
+	// The index points to the bits, it must be rebuilt when they change and must not outlive them.
+	template<IAllocator Allocator = DefaultAllocator>
+	class BitRankSelect
+	{
+	public:
+		REX_CORE_NO_COPY(BitRankSelect);
+		REX_CORE_DEFAULT_MOVE(BitRankSelect);
+
+		explicit BitRankSelect(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_blockRanks(allocator)
+		{
+			m_blockRanks.EmplaceBack(0llu); // Queries before Build() see empty bits
+		}
+
+		template<typename BitSetT>
+		void Build(const BitSetT& bits)
+		{
+			REX_CORE_TRACE_FUNC();
+			m_words = bits.Data();
+			m_numWords = bits.NumWords();
+			m_size = bits.Size();
+
+			const U64 numBlocks = Math::CeilDiv<U64>(m_numWords, WordsPerBlock);
+			m_blockRanks.Clear();
+			m_blockRanks.Reserve(static_cast<U32>(numBlocks + 1));
+			U64 rank = 0;
+			for (U64 block = 0; block < numBlocks; block++)
+			{
+				m_blockRanks.EmplaceBack(rank);
+				const U64 first = block * WordsPerBlock;
+				rank += Internal::PopCountWords(m_words + first, Math::Min(WordsPerBlock, m_numWords - first));
+			}
+			m_blockRanks.EmplaceBack(rank); // Total, so the binary search of Select() has an upper bound
+		}
+
+		// Number of set bits in the total
+		[[nodiscard]] U64 PopCount() const { return m_blockRanks.IsEmpty() ? 0 : m_blockRanks.Last(); }
+
+		// Number of set bits in [0, index)
+		[[nodiscard]] U64 Rank(U64 index) const
+		{
+			REX_CORE_ASSERT(index <= m_size);
+			const U64 wordIndex = index / 64;
+			const U64 block = wordIndex / WordsPerBlock;
+			U64 rank = m_blockRanks[static_cast<U32>(block)];
+			for (U64 i = block * WordsPerBlock; i < wordIndex; i++)
+				rank += static_cast<U64>(std::popcount(m_words[i]));
+			if (index % 64 != 0)
+				rank += static_cast<U64>(std::popcount(m_words[wordIndex] & ((1llu << (index % 64)) - 1)));
+			return rank;
+		}
+
+		// Position of the set bit with the given rank (the first set bit has rank 0), will return Size() of the bits if
+		// there are not enough set bits
+		[[nodiscard]] U64 Select(U64 rank) const
+		{
+			if (rank >= PopCount())
+				return m_size;
+
+			// Last block starting with at most rank set bits before it
+			const U64 block = UpperBound(m_blockRanks.Data(), m_blockRanks.Size(), rank) - 1;
+			U64 remaining = rank - m_blockRanks[static_cast<U32>(block)];
+			for (U64 i = block * WordsPerBlock;; i++)
+			{
+				const U64 count = static_cast<U64>(std::popcount(m_words[i]));
+				if (remaining < count)
+					return i * 64 + Internal::SelectInWord(m_words[i], static_cast<U32>(remaining));
+				remaining -= count;
+			}
+		}
+
+	private:
+		constexpr static U64 WordsPerBlock = 8; // 512 bits, a cache line
+
+		const U64* m_words = nullptr;
+		U64 m_numWords = 0;
+		U64 m_size = 0;
+		Vector<U64, Allocator> m_blockRanks; // Set bits before each block, followed by the total
+	};
+}
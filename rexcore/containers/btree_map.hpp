@@ -0,0 +1,773 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/algorithms.hpp>
+#include <rexcore/concepts.hpp>
+#include <rexcore/iterators.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/simd.hpp>
+#include <rexcore/containers/vector.hpp>
+
+#include <bit>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace RexCore
+{
+	namespace Internal
+	{
+		// Storage for up to N items constructed and destroyed by the owner
+		template<typename T, U32 N>
+		struct UninitializedArray
+		{
+			[[nodiscard]] T* Data() { return reinterpret_cast<T*>(m_data); }
+			[[nodiscard]] const T* Data() const { return reinterpret_cast<const T*>(m_data); }
+			[[nodiscard]] T& operator[](U32 index) { return Data()[index]; }
+			[[nodiscard]] const T& operator[](U32 index) const { return Data()[index]; }
+
+		private:
+			alignas(T) Byte m_data[sizeof(T) * N];
+		};
+
+		// Moves count items from src to the uninitialized dest and leaves src uninitialized, the ranges can overlap
+		template<typename T>
+		void RelocateItems(T* src, T* dest, U32 count)
+		{
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				MemMove(src, dest, static_cast<U64>(count) * sizeof(T));
+			}
+			else if (dest < src)
+			{
+				for (U32 i = 0; i < count; i++)
+				{
+					std::construct_at(dest + i, std::move(src[i]));
+					std::destroy_at(src + i);
+				}
+			}
+			else
+			{
+				for (U32 i = count; i-- > 0;)
+				{
+					std::construct_at(dest + i, std::move(src[i]));
+					std::destroy_at(src + i);
+				}
+			}
+		}
+
+		template<typename Key, typename K, typename Compare>
+		constexpr bool IsBTreeCountSearch = std::is_arithmetic_v<Key> && std::is_same_v<Key, std::remove_cvref_t<K>> &&
+			(std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<Key>>);
+
+		// Number of keys of a node ordered before key, or not ordered after key when OrEqual is set.
+		// Arithmetic keys are counted over the whole node without branches, 4 at a time with SSE2 for 32 bit integers,
+		// the other keys use a branchless binary search.
+		template<bool OrEqual, typename Key, typename K, typename Compare>
+		[[nodiscard]] U32 BTreeNodeSearch(const Key* keys, U32 size, const K& key, Compare comp)
+		{
+			if constexpr (IsBTreeCountSearch<Key, K, Compare>)
+			{
+				U32 count = 0;
+				U32 i = 0;
+#if defined(REX_CORE_SSE2)
+				if constexpr (std::is_integral_v<Key> && sizeof(Key) == 4)
+				{
+					// SSE2 only has signed comparisons, flipping the sign bit orders unsigned values the same way
+					const __m128i bias = _mm_set1_epi32(std::is_signed_v<Key> ? 0 : static_cast<S32>(0x80000000u));
+					const __m128i needle = _mm_xor_si128(_mm_set1_epi32(static_cast<S32>(key)), bias);
+					for (; i + 4 <= size; i += 4)
+					{
+						const __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), bias);
+						if constexpr (OrEqual)
+							count += 4 - std::popcount(static_cast<U32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(block, needle)))));
+						else
+							count += std::popcount(static_cast<U32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(needle, block)))));
+					}
+				}
+#endif
+				for (; i < size; i++)
+				{
+					if constexpr (OrEqual)
+						count += key < keys[i] ? 0 : 1;
+					else
+						count += keys[i] < key ? 1 : 0;
+				}
+				return count;
+			}
+			else if constexpr (OrEqual)
+			{
+				return static_cast<U32>(UpperBound(keys, size, key, comp));
+			}
+			else
+			{
+				return static_cast<U32>(LowerBound(keys, size, key, comp));
+			}
+		}
+	}
+
+	// Ordered map stored in a B+ tree : the items are in the leaves, linked to each other for the range scans, and the
+	// internal nodes only hold copies of the keys separating their children. Keys and values are stored in separate
+	// arrays in each node so the searches only read the keys. The nodes are NodeBytes big, 512 bytes by default
+	// (8 cache lines), and come from two PoolAllocators owned by the map.
+	// Keys must be IClonable, the internal nodes hold clones of the keys.
+	// Iterators invalidation : any insert or erase
+	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Compare = std::less<>, U32 NodeBytes = 512>
+	class BTreeMap
+	{
+		struct Node;
+		struct LeafNode;
+		struct InternalNode;
+
+	public:
+		constexpr static U32 LeafCapacity = static_cast<U32>(Math::Max<U64>((NodeBytes - 4 * sizeof(void*)) / (sizeof(Key) + sizeof(Value)), 4));
+		constexpr static U32 InternalCapacity = static_cast<U32>(Math::Max<U64>((NodeBytes - 3 * sizeof(void*)) / (sizeof(Key) + sizeof(void*)), 4));
+
+		template<typename ValT>
+		class IteratorBase
+		{
+		public:
+			IteratorBase() noexcept = default;
+
+			IteratorBase(LeafNode* leaf, U32 index) noexcept
+				: m_leaf(leaf), m_index(index)
+			{}
+
+			[[nodiscard]] friend bool operator==(const IteratorBase& lhs, const IteratorBase& rhs)
+			{
+				return lhs.m_leaf == rhs.m_leaf && lhs.m_index == rhs.m_index;
+			}
+			[[nodiscard]] friend bool operator!=(const IteratorBase& lhs, const IteratorBase& rhs)
+			{
+				return !(lhs == rhs);
+			}
+
+			IteratorBase& operator++()
+			{
+				m_index++;
+				if (m_index == m_leaf->size)
+				{
+					m_leaf = m_leaf->next;
+					m_index = 0;
+				}
+				return *this;
+			}
+			IteratorBase operator++(int)
+			{
+				IteratorBase copy(*this);
+				++*this;
+				return copy;
+			}
+
+			[[nodiscard]] const Key& GetKey() const { return m_leaf->keys[m_index]; }
+			[[nodiscard]] ValT& GetValue() const { return m_leaf->values[m_index]; }
+
+			// Keys and values are in separate arrays, the pair only holds references to them
+			[[nodiscard]] std::pair<const Key&, ValT&> operator*() const { return { GetKey(), GetValue() }; }
+
+			[[nodiscard]] operator IteratorBase<const ValT>() const
+			{
+				return { m_leaf, m_index };
+			}
+
+		private:
+			friend class BTreeMap;
+
+			LeafNode* m_leaf = nullptr;
+			U32 m_index = 0;
+		};
+
+		using Iterator = IteratorBase<Value>;
+		using ConstIterator = IteratorBase<const Value>;
+
+	public:
+		REX_CORE_NO_COPY(BTreeMap);
+
+		explicit BTreeMap(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_leafPool(allocator), m_internalPool(allocator)
+		{}
+
+		BTreeMap(BTreeMap&& other) noexcept
+			: m_leafPool(std::move(other.m_leafPool)), m_internalPool(std::move(other.m_internalPool)),
+			m_root(std::exchange(other.m_root, nullptr)), m_first(std::exchange(other.m_first, nullptr)), m_size(std::exchange(other.m_size, 0))
+		{}
+
+		BTreeMap& operator=(BTreeMap&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			Clear();
+			m_leafPool = std::move(other.m_leafPool);
+			m_internalPool = std::move(other.m_internalPool);
+			m_root = std::exchange(other.m_root, nullptr);
+			m_first = std::exchange(other.m_first, nullptr);
+			m_size = std::exchange(other.m_size, 0);
+			return *this;
+		}
+
+		~BTreeMap()
+		{
+			Clear();
+		}
+
+		// Builds the tree bottom up from keys sorted by Compare without duplicates, values[i] belongs to keys[i].
+		// The nodes are filled evenly instead of being split one insert at a time.
+		[[nodiscard]] static BTreeMap BulkBuild(Vector<Key, Allocator>&& keys, Vector<Value, Allocator>&& values)
+		{
+			REX_CORE_TRACE_FUNC();
+			REX_CORE_ASSERT(keys.Size() == values.Size());
+			for (U64 i = 1; i < keys.Size(); i++)
+				REX_CORE_ASSERT(Compare{}(keys[i - 1], keys[i]), "The keys must be sorted and unique");
+
+			BTreeMap map(keys.GetAllocator());
+			const U64 count = keys.Size();
+			if (count == 0)
+				return map;
+
+			Vector<Node*, Allocator> level(keys.GetAllocator());
+			Vector<const Key*, Allocator> firstKeys(keys.GetAllocator()); // Smallest key under each node of the level
+
+			const U64 numLeaves = Math::CeilDiv<U64>(count, LeafCapacity);
+			U64 item = 0;
+			LeafNode* previous = nullptr;
+			for (U64 i = 0; i < numLeaves; i++)
+			{
+				LeafNode* leaf = map.NewLeaf();
+				const U32 size = static_cast<U32>(count / numLeaves + (i < count % numLeaves ? 1 : 0));
+				for (U32 j = 0; j < size; j++, item++)
+				{
+					std::construct_at(&leaf->keys[j], std::move(keys[item]));
+					std::construct_at(&leaf->values[j], std::move(values[item]));
+				}
+				leaf->size = size;
+
+				leaf->prev = previous;
+				if (previous != nullptr)
+					previous->next = leaf;
+				else
+					map.m_first = leaf;
+				previous = leaf;
+
+				level.EmplaceBack(leaf);
+				firstKeys.EmplaceBack(&leaf->keys[0]);
+			}
+
+			while (level.Size() > 1)
+			{
+				Vector<Node*, Allocator> parents(keys.GetAllocator());
+				Vector<const Key*, Allocator> parentFirstKeys(keys.GetAllocator());
+				const U64 numParents = Math::CeilDiv<U64>(level.Size(), InternalCapacity + 1);
+				U32 child = 0;
+				for (U64 i = 0; i < numParents; i++)
+				{
+					InternalNode* node = map.NewInternal();
+					const U32 numChildren = static_cast<U32>(level.Size() / numParents + (i < level.Size() % numParents ? 1 : 0));
+					parentFirstKeys.EmplaceBack(firstKeys[child]);
+					for (U32 j = 0; j < numChildren; j++, child++)
+					{
+						node->children[j] = level[child];
+						level[child]->parent = node;
+						if (j > 0)
+							std::construct_at(&node->keys[j - 1], RexCore::Clone(*firstKeys[child]));
+					}
+					node->size = numChildren - 1;
+					parents.EmplaceBack(node);
+				}
+
+				level = std::move(parents);
+				firstKeys = std::move(parentFirstKeys);
+			}
+
+			map.m_root = level[0];
+			map.m_size = count;
+			return map;
+		}
+
+		[[nodiscard]] U64 Size() const { return m_size; }
+		[[nodiscard]] bool IsEmpty() const { return m_size == 0; }
+
+		// Will return End() if not found
+		template<typename K>
+		[[nodiscard]] Iterator Find(const K& key) { return FindImpl(key); }
+
+		template<typename K>
+		[[nodiscard]] ConstIterator Find(const K& key) const { return FindImpl(key); }
+
+		template<typename K>
+		[[nodiscard]] bool Contains(const K& key) const { return FindImpl(key) != End(); }
+
+		template<typename K>
+		Value& At(const K& key)
+		{
+			Iterator found = Find(key);
+			REX_CORE_ASSERT(found != End(), "Value not found ! use Find() instead");
+			return found.GetValue();
+		}
+
+		template<typename K>
+		const Value& At(const K& key) const
+		{
+			ConstIterator found = Find(key);
+			REX_CORE_ASSERT(found != End(), "Value not found ! use Find() instead");
+			return found.GetValue();
+		}
+
+		// First item not ordered before key, End() if there is none
+		template<typename K>
+		[[nodiscard]] Iterator LowerBound(const K& key) { return BoundImpl<false>(key); }
+
+		template<typename K>
+		[[nodiscard]] ConstIterator LowerBound(const K& key) const { return BoundImpl<false>(key); }
+
+		// First item ordered after key, End() if there is none
+		template<typename K>
+		[[nodiscard]] Iterator UpperBound(const K& key) { return BoundImpl<true>(key); }
+
+		template<typename K>
+		[[nodiscard]] ConstIterator UpperBound(const K& key) const { return BoundImpl<true>(key); }
+
+		// Items with keys in [first, last) : for (auto [key, value] : map.Range(first, last))
+		template<typename K>
+		[[nodiscard]] Iter::ContainerView<Iterator> Range(const K& first, const K& last)
+		{
+			return { LowerBound(first), Compare{}(first, last) ? LowerBound(last) : LowerBound(first) };
+		}
+
+		template<typename K>
+		[[nodiscard]] Iter::ContainerView<ConstIterator> Range(const K& first, const K& last) const
+		{
+			return { LowerBound(first), Compare{}(first, last) ? LowerBound(last) : LowerBound(first) };
+		}
+
+		// Returns the item of key and true if it was inserted, false if the key was already there (its value is left untouched)
+		template<typename K, typename ...Args>
+		std::pair<Iterator, bool> Insert(K&& key, Args&& ...args)
+		{
+			REX_CORE_TRACE_FUNC();
+			if (m_root == nullptr)
+			{
+				m_first = NewLeaf();
+				m_root = m_first;
+			}
+
+			LeafNode* leaf = FindLeaf(key);
+			U32 index = Internal::BTreeNodeSearch<false>(leaf->keys.Data(), leaf->size, key, Compare{});
+			if (index < leaf->size && !Compare{}(key, leaf->keys[index]))
+				return { Iterator(leaf, index), false };
+
+			if (leaf->size == LeafCapacity)
+			{
+				LeafNode* right = SplitLeaf(leaf);
+				if (index > leaf->size)
+				{
+					index -= leaf->size;
+					leaf = right;
+				}
+			}
+
+			Internal::RelocateItems(leaf->keys.Data() + index, leaf->keys.Data() + index + 1, leaf->size - index);
+			Internal::RelocateItems(leaf->values.Data() + index, leaf->values.Data() + index + 1, leaf->size - index);
+			std::construct_at(&leaf->keys[index], std::forward<K>(key));
+			std::construct_at(&leaf->values[index], std::forward<Args>(args)...);
+			leaf->size++;
+			m_size++;
+			return { Iterator(leaf, index), true };
+		}
+
+		template<typename K, typename ...Args>
+		void InsertOrAssign(K&& key, Args&& ...args)
+		{
+			const Iterator found = Find(key);
+			if (found != End())
+				found.GetValue() = Value(std::forward<Args>(args)...);
+			else
+				Insert(std::forward<K>(key), std::forward<Args>(args)...);
+		}
+
+		template<typename K>
+		bool Erase(const K& key)
+		{
+			REX_CORE_TRACE_FUNC();
+			if (m_root == nullptr)
+				return false;
+
+			LeafNode* leaf = FindLeaf(key);
+			const U32 index = Internal::BTreeNodeSearch<false>(leaf->keys.Data(), leaf->size, key, Compare{});
+			if (index == leaf->size || Compare{}(key, leaf->keys[index]))
+				return false;
+
+			std::destroy_at(&leaf->keys[index]);
+			std::destroy_at(&leaf->values[index]);
+			Internal::RelocateItems(leaf->keys.Data() + index + 1, leaf->keys.Data() + index, leaf->size - index - 1);
+			Internal::RelocateItems(leaf->values.Data() + index + 1, leaf->values.Data() + index, leaf->size - index - 1);
+			leaf->size--;
+			m_size--;
+			RebalanceLeaf(leaf);
+			return true;
+		}
+
+		void Clear()
+		{
+			if (m_root != nullptr)
+				FreeNode(m_root);
+			m_root = nullptr;
+			m_first = nullptr;
+			m_size = 0;
+		}
+
+		[[nodiscard]] Iterator Begin() { return Iterator(m_first, 0); }
+		[[nodiscard]] Iterator End() { return Iterator(); }
+		[[nodiscard]] ConstIterator Begin() const { return ConstIterator(m_first, 0); }
+		[[nodiscard]] ConstIterator End() const { return ConstIterator(); }
+
+	public:
+		[[nodiscard]] Iterator begin() { return Begin(); }
+		[[nodiscard]] Iterator end() { return End(); }
+		[[nodiscard]] ConstIterator begin() const { return Begin(); }
+		[[nodiscard]] ConstIterator end() const { return End(); }
+
+	private:
+		constexpr static U32 MinLeafSize = LeafCapacity / 2;
+		constexpr static U32 MinInternalSize = InternalCapacity / 2;
+
+		struct Node
+		{
+			InternalNode* parent = nullptr;
+			U32 size = 0; // Number of keys
+			bool isLeaf = true;
+		};
+
+		struct alignas(64) LeafNode : Node
+		{
+			LeafNode* prev = nullptr;
+			LeafNode* next = nullptr;
+			Internal::UninitializedArray<Key, LeafCapacity> keys;
+			Internal::UninitializedArray<Value, LeafCapacity> values;
+		};
+
+		struct alignas(64) InternalNode : Node
+		{
+			// Every key under children[i] is ordered before keys[i], every key under children[i + 1] isn't
+			Internal::UninitializedArray<Key, InternalCapacity> keys;
+			Node* children[InternalCapacity + 1];
+		};
+
+		using LeafPool = PoolAllocatorBase<sizeof(LeafNode), alignof(LeafNode), Allocator>;
+		using InternalPool = PoolAllocatorBase<sizeof(InternalNode), alignof(InternalNode), Allocator>;
+
+		[[nodiscard]] LeafNode* NewLeaf()
+		{
+			return new (m_leafPool.Allocate(sizeof(LeafNode), alignof(LeafNode))) LeafNode;
+		}
+
+		[[nodiscard]] InternalNode* NewInternal()
+		{
+			InternalNode* node = new (m_internalPool.Allocate(sizeof(InternalNode), alignof(InternalNode))) InternalNode;
+			node->isLeaf = false;
+			return node;
+		}
+
+		void FreeNode(Node* node)
+		{
+			if (node->isLeaf)
+			{
+				LeafNode* leaf = static_cast<LeafNode*>(node);
+				std::destroy_n(leaf->keys.Data(), leaf->size);
+				std::destroy_n(leaf->values.Data(), leaf->size);
+				std::destroy_at(leaf);
+				m_leafPool.Free(leaf, sizeof(LeafNode));
+			}
+			else
+			{
+				InternalNode* internal = static_cast<InternalNode*>(node);
+				for (U32 i = 0; i <= internal->size; i++)
+					FreeNode(internal->children[i]);
+				std::destroy_n(internal->keys.Data(), internal->size);
+				std::destroy_at(internal);
+				m_internalPool.Free(internal, sizeof(InternalNode));
+			}
+		}
+
+		template<typename K>
+		[[nodiscard]] LeafNode* FindLeaf(const K& key) const
+		{
+			Node* node = m_root;
+			while (!node->isLeaf)
+			{
+				InternalNode* internal = static_cast<InternalNode*>(node);
+				node = internal->children[Internal::BTreeNodeSearch<true>(internal->keys.Data(), internal->size, key, Compare{})];
+			}
+			return static_cast<LeafNode*>(node);
+		}
+
+		template<typename K>
+		[[nodiscard]] Iterator FindImpl(const K& key) const
+		{
+			if (m_root == nullptr)
+				return Iterator();
+
+			LeafNode* leaf = FindLeaf(key);
+			const U32 index = Internal::BTreeNodeSearch<false>(leaf->keys.Data(), leaf->size, key, Compare{});
+			if (index == leaf->size || Compare{}(key, leaf->keys[index]))
+				return Iterator();
+			return Iterator(leaf, index);
+		}
+
+		template<bool Upper, typename K>
+		[[nodiscard]] Iterator BoundImpl(const K& key) const
+		{
+			if (m_root == nullptr)
+				return Iterator();
+
+			// The separators lead to the only leaf that can hold the bound, unless it's past its last key
+			LeafNode* leaf = FindLeaf(key);
+			const U32 index = Internal::BTreeNodeSearch<Upper>(leaf->keys.Data(), leaf->size, key, Compare{});
+			if (index == leaf->size)
+				return Iterator(leaf->next, 0);
+			return Iterator(leaf, index);
+		}
+
+		[[nodiscard]] static U32 ChildIndex(const InternalNode* parent, const Node* child)
+		{
+			U32 index = 0;
+			while (parent->children[index] != child)
+				index++;
+			return index;
+		}
+
+		// Moves the upper half of a full leaf to a new leaf on its right
+		LeafNode* SplitLeaf(LeafNode* leaf)
+		{
+			LeafNode* right = NewLeaf();
+			const U32 half = leaf->size / 2;
+			right->size = leaf->size - half;
+			Internal::RelocateItems(leaf->keys.Data() + half, right->keys.Data(), right->size);
+			Internal::RelocateItems(leaf->values.Data() + half, right->values.Data(), right->size);
+			leaf->size = half;
+
+			right->prev = leaf;
+			right->next = leaf->next;
+			if (right->next != nullptr)
+				right->next->prev = right;
+			leaf->next = right;
+
+			InsertIntoParent(leaf, RexCore::Clone(right->keys[0]), right);
+			return right;
+		}
+
+		// Moves the keys and children after the middle key of a full internal node to a new node, the middle key goes up
+		void SplitInternal(InternalNode* node)
+		{
+			InternalNode* right = NewInternal();
+			const U32 middle = node->size / 2;
+			right->size = node->size - middle - 1;
+			Internal::RelocateItems(node->keys.Data() + middle + 1, right->keys.Data(), right->size);
+			for (U32 i = 0; i <= right->size; i++)
+			{
+				right->children[i] = node->children[middle + 1 + i];
+				right->children[i]->parent = right;
+			}
+
+			Key separator = std::move(node->keys[middle]);
+			std::destroy_at(&node->keys[middle]);
+			node->size = middle;
+			InsertIntoParent(node, std::move(separator), right);
+		}
+
+		// right is the new sibling after left, separated by separator
+		void InsertIntoParent(Node* left, Key&& separator, Node* right)
+		{
+			InternalNode* parent = left->parent;
+			if (parent == nullptr)
+			{
+				InternalNode* root = NewInternal();
+				std::construct_at(&root->keys[0], std::move(separator));
+				root->children[0] = left;
+				root->children[1] = right;
+				root->size = 1;
+				left->parent = root;
+				right->parent = root;
+				m_root = root;
+				return;
+			}
+
+			if (parent->size == InternalCapacity)
+			{
+				SplitInternal(parent);
+				parent = left->parent;
+			}
+
+			const U32 index = ChildIndex(parent, left);
+			Internal::RelocateItems(parent->keys.Data() + index, parent->keys.Data() + index + 1, parent->size - index);
+			std::construct_at(&parent->keys[index], std::move(separator));
+			MemMove(parent->children + index + 1, parent->children + index + 2, (parent->size - index) * sizeof(Node*));
+			parent->children[index + 1] = right;
+			right->parent = parent;
+			parent->size++;
+		}
+
+		// Removes keys[index] and children[index + 1]
+		void RemoveFromInternal(InternalNode* node, U32 index)
+		{
+			std::destroy_at(&node->keys[index]);
+			Internal::RelocateItems(node->keys.Data() + index + 1, node->keys.Data() + index, node->size - index - 1);
+			MemMove(node->children + index + 2, node->children + index + 1, (node->size - index - 1) * sizeof(Node*));
+			node->size--;
+		}
+
+		void RebalanceLeaf(LeafNode* leaf)
+		{
+			if (leaf == m_root)
+			{
+				if (leaf->size == 0)
+					Clear();
+				return;
+			}
+
+			if (leaf->size >= MinLeafSize)
+				return;
+
+			InternalNode* parent = leaf->parent;
+			const U32 index = ChildIndex(parent, leaf);
+			LeafNode* left = index > 0 ? static_cast<LeafNode*>(parent->children[index - 1]) : nullptr;
+			LeafNode* right = index < parent->size ? static_cast<LeafNode*>(parent->children[index + 1]) : nullptr;
+
+			if (right != nullptr && right->size > MinLeafSize)
+			{
+				// Take the first item of the right sibling
+				Internal::RelocateItems(right->keys.Data(), leaf->keys.Data() + leaf->size, 1);
+				Internal::RelocateItems(right->values.Data(), leaf->values.Data() + leaf->size, 1);
+				Internal::RelocateItems(right->keys.Data() + 1, right->keys.Data(), right->size - 1);
+				Internal::RelocateItems(right->values.Data() + 1, right->values.Data(), right->size - 1);
+				leaf->size++;
+				right->size--;
+				parent->keys[index] = RexCore::Clone(right->keys[0]);
+			}
+			else if (left != nullptr && left->size > MinLeafSize)
+			{
+				// Take the last item of the left sibling
+				Internal::RelocateItems(leaf->keys.Data(), leaf->keys.Data() + 1, leaf->size);
+				Internal::RelocateItems(leaf->values.Data(), leaf->values.Data() + 1, leaf->size);
+				Internal::RelocateItems(left->keys.Data() + left->size - 1, leaf->keys.Data(), 1);
+				Internal::RelocateItems(left->values.Data() + left->size - 1, leaf->values.Data(), 1);
+				leaf->size++;
+				left->size--;
+				parent->keys[index - 1] = RexCore::Clone(leaf->keys[0]);
+			}
+			else if (right != nullptr)
+			{
+				MergeLeaves(leaf, right, index);
+			}
+			else
+			{
+				MergeLeaves(left, leaf, index - 1);
+			}
+		}
+
+		// Moves the items of right at the end of left and removes right, separated by parent->keys[separator]
+		void MergeLeaves(LeafNode* left, LeafNode* right, U32 separator)
+		{
+			Internal::RelocateItems(right->keys.Data(), left->keys.Data() + left->size, right->size);
+			Internal::RelocateItems(right->values.Data(), left->values.Data() + left->size, right->size);
+			left->size += right->size;
+			right->size = 0;
+
+			left->next = right->next;
+			if (left->next != nullptr)
+				left->next->prev = left;
+
+			InternalNode* parent = left->parent;
+			RemoveFromInternal(parent, separator);
+			FreeNode(right);
+			RebalanceInternal(parent);
+		}
+
+		void RebalanceInternal(InternalNode* node)
+		{
+			if (node == m_root)
+			{
+				if (node->size == 0)
+				{
+					// The only child becomes the root
+					m_root = node->children[0];
+					m_root->parent = nullptr;
+					std::destroy_at(node);
+					m_internalPool.Free(node, sizeof(InternalNode));
+				}
+				return;
+			}
+
+			if (node->size >= MinInternalSize)
+				return;
+
+			InternalNode* parent = node->parent;
+			const U32 index = ChildIndex(parent, node);
+			InternalNode* left = index > 0 ? static_cast<InternalNode*>(parent->children[index - 1]) : nullptr;
+			InternalNode* right = index < parent->size ? static_cast<InternalNode*>(parent->children[index + 1]) : nullptr;
+
+			if (right != nullptr && right->size > MinInternalSize)
+			{
+				// Rotate through the parent, its separator comes down and the first key of the right sibling goes up
+				std::construct_at(&node->keys[node->size], std::move(parent->keys[index]));
+				node->children[node->size + 1] = right->children[0];
+				node->children[node->size + 1]->parent = node;
+				node->size++;
+
+				parent->keys[index] = std::move(right->keys[0]);
+				std::destroy_at(&right->keys[0]);
+				Internal::RelocateItems(right->keys.Data() + 1, right->keys.Data(), right->size - 1);
+				MemMove(right->children + 1, right->children, right->size * sizeof(Node*));
+				right->size--;
+			}
+			else if (left != nullptr && left->size > MinInternalSize)
+			{
+				Internal::RelocateItems(node->keys.Data(), node->keys.Data() + 1, node->size);
+				MemMove(node->children, node->children + 1, (node->size + 1) * sizeof(Node*));
+				std::construct_at(&node->keys[0], std::move(parent->keys[index - 1]));
+				node->children[0] = left->children[left->size];
+				node->children[0]->parent = node;
+				node->size++;
+
+				parent->keys[index - 1] = std::move(left->keys[left->size - 1]);
+				std::destroy_at(&left->keys[left->size - 1]);
+				left->size--;
+			}
+			else if (right != nullptr)
+			{
+				MergeInternal(node, right, index);
+			}
+			else
+			{
+				MergeInternal(left, node, index - 1);
+			}
+		}
+
+		// Moves the separator and the keys and children of right at the end of left and removes right
+		void MergeInternal(InternalNode* left, InternalNode* right, U32 separator)
+		{
+			InternalNode* parent = left->parent;
+			std::construct_at(&left->keys[left->size], std::move(parent->keys[separator]));
+			Internal::RelocateItems(right->keys.Data(), left->keys.Data() + left->size + 1, right->size);
+			for (U32 i = 0; i <= right->size; i++)
+			{
+				left->children[left->size + 1 + i] = right->children[i];
+				left->children[left->size + 1 + i]->parent = left;
+			}
+			left->size += right->size + 1;
+
+			std::destroy_at(right);
+			m_internalPool.Free(right, sizeof(InternalNode));
+			RemoveFromInternal(parent, separator);
+			RebalanceInternal(parent);
+		}
+
+	private:
+		LeafPool m_leafPool;
+		InternalPool m_internalPool;
+		Node* m_root = nullptr;
+		LeafNode* m_first = nullptr;
+		U64 m_size = 0;
+	};
+}
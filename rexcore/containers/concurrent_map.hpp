@@ -0,0 +1,220 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/containers/map.hpp>
+#include <rexcore/containers/vector.hpp>
+
+#include <rexcore/vendors/unordered_dense.hpp>
+
+#include <bit>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+namespace RexCore
+{
+	namespace Internal
+	{
+		// Shard of a key for containers split in numShards (a power of 2) unordered_dense tables
+		template<typename Hash, typename K>
+		[[nodiscard]] U32 ShardIndex(const K& key, U32 numShards)
+		{
+			U64 hash = Hash{}(key);
+			if constexpr (!requires { typename Hash::is_avalanching; })
+				hash = ankerl::unordered_dense::detail::wyhash::hash(hash);
+
+			// unordered_dense uses the highest bits for the bucket and the lowest byte as a fingerprint, use bits from the middle
+			return static_cast<U32>(hash >> 32llu) & (numShards - 1);
+		}
+	}
+
+	// Thread safe hash map split in shards by hash, each shard is a HashMap with its own reader-writer lock so threads
+	// working on different shards never wait on each other and readers of the same shard don't either.
+	// Values are never handed out by reference outside of a lock, use Visit()/Update() to work on them in place.
+	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>, U32 NumShards = 64>
+	class ConcurrentHashMap
+	{
+	public:
+		using ShardMap = HashMap<Key, Value, Allocator, Hash>;
+
+		static_assert(std::has_single_bit(NumShards), "The number of shards must be a power of 2");
+
+		REX_CORE_NO_COPY(ConcurrentHashMap);
+		REX_CORE_NO_MOVE(ConcurrentHashMap);
+
+		ConcurrentHashMap(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+		{
+			for (U32 i = 0; i < NumShards; i++)
+				m_shards.EmplaceBack(allocator);
+		}
+
+		// Sum of the shard sizes, each shard is locked in turn so it's not a snapshot while other threads are writing
+		[[nodiscard]] U64 Size() const
+		{
+			U64 size = 0;
+			for (const Shard& shard : m_shards)
+			{
+				std::shared_lock lock(shard.mutex);
+				size += shard.map.Size();
+			}
+			return size;
+		}
+
+		[[nodiscard]] bool IsEmpty() const { return Size() == 0; }
+
+		// Reserves room for size items spread evenly over the shards
+		void Reserve(U64 size)
+		{
+			for (Shard& shard : m_shards)
+			{
+				std::unique_lock lock(shard.mutex);
+				shard.map.Reserve((size + NumShards - 1) / NumShards);
+			}
+		}
+
+		template<typename K>
+		[[nodiscard]] bool Contains(const K& key) const
+		{
+			const Shard& shard = GetShard(key);
+			std::shared_lock lock(shard.mutex);
+			return shard.map.Contains(key);
+		}
+
+		// Returns a copy of the value, std::nullopt if not found
+		template<typename K>
+		[[nodiscard]] std::optional<Value> Find(const K& key) const
+		{
+			const Shard& shard = GetShard(key);
+			std::shared_lock lock(shard.mutex);
+			const auto found = shard.map.Find(key);
+			if (found == shard.map.End())
+				return std::nullopt;
+			return found->second;
+		}
+
+		// Calls fn(const Value&) under a shared lock, returns false if not found
+		template<typename K, typename Fn>
+		bool Visit(const K& key, Fn&& fn) const
+		{
+			const Shard& shard = GetShard(key);
+			std::shared_lock lock(shard.mutex);
+			const auto found = shard.map.Find(key);
+			if (found == shard.map.End())
+				return false;
+
+			fn(found->second);
+			return true;
+		}
+
+		// Calls fn(Value&) under an exclusive lock, returns false if not found
+		template<typename K, typename Fn>
+		bool Update(const K& key, Fn&& fn)
+		{
+			Shard& shard = GetShard(key);
+			std::unique_lock lock(shard.mutex);
+			const auto found = shard.map.Find(key);
+			if (found == shard.map.End())
+				return false;
+
+			fn(found->second);
+			return true;
+		}
+
+		// Returns true if the value was inserted, false if the key was already there
+		template<typename K, typename ...Args>
+		bool Insert(K&& key, Args&& ...args)
+		{
+			Shard& shard = GetShard(key);
+			std::unique_lock lock(shard.mutex);
+			return shard.map.Insert(std::forward<K>(key), std::forward<Args>(args)...).second;
+		}
+
+		template<typename ...Args>
+		void InsertOrAssign(const Key& key, Args&& ...args)
+		{
+			Shard& shard = GetShard(key);
+			std::unique_lock lock(shard.mutex);
+			shard.map.InsertOrAssign(key, std::forward<Args>(args)...);
+		}
+
+		// Returns a copy of the existing value, or constructs one from args and returns a copy of it.
+		// Only takes a shared lock when the key is already there.
+		template<typename K, typename ...Args>
+		[[nodiscard]] Value FindOrInsert(K&& key, Args&& ...args)
+		{
+			Shard& shard = GetShard(key);
+			{
+				std::shared_lock lock(shard.mutex);
+				const auto found = shard.map.Find(key);
+				if (found != shard.map.End())
+					return found->second;
+			}
+
+			std::unique_lock lock(shard.mutex);
+			return shard.map.Insert(std::forward<K>(key), std::forward<Args>(args)...).first->second; // Another thread might have inserted it since, Insert() keeps the existing value
+		}
+
+		template<typename K>
+		bool Erase(const K& key)
+		{
+			Shard& shard = GetShard(key);
+			std::unique_lock lock(shard.mutex);
+			return shard.map.Erase(key);
+		}
+
+		void Clear()
+		{
+			for (Shard& shard : m_shards)
+			{
+				std::unique_lock lock(shard.mutex);
+				shard.map.Clear();
+			}
+		}
+
+		// Calls fn(const ShardMap&) for each shard under a shared lock
+		template<typename Fn>
+		void ForEachShard(Fn&& fn) const
+		{
+			for (const Shard& shard : m_shards)
+			{
+				std::shared_lock lock(shard.mutex);
+				fn(shard.map);
+			}
+		}
+
+		// Calls fn(ShardMap&) for each shard under an exclusive lock
+		template<typename Fn>
+		void ForEachShard(Fn&& fn)
+		{
+			for (Shard& shard : m_shards)
+			{
+				std::unique_lock lock(shard.mutex);
+				fn(shard.map);
+			}
+		}
+
+	private:
+		// Each shard is on its own cache lines so the locks of neighbouring shards don't false-share
+		struct alignas(64) Shard
+		{
+			REX_CORE_NO_COPY(Shard);
+			REX_CORE_NO_MOVE(Shard);
+
+			explicit Shard(AllocatorRef<Allocator> allocator)
+				: map(allocator)
+			{}
+
+			mutable std::shared_mutex mutex;
+			ShardMap map;
+		};
+
+		template<typename K>
+		[[nodiscard]] Shard& GetShard(const K& key) { return m_shards[Internal::ShardIndex<Hash>(key, NumShards)]; }
+
+		template<typename K>
+		[[nodiscard]] const Shard& GetShard(const K& key) const { return m_shards[Internal::ShardIndex<Hash>(key, NumShards)]; }
+
+	private:
+		FixedVector<Shard, NumShards> m_shards;
+	};
+}
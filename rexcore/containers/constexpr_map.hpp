@@ -0,0 +1,194 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/containers/string.hpp>
+
+#include <rexcore/vendors/unordered_dense.hpp>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <utility>
+
+namespace RexCore
+{
+	namespace Internal
+	{
+		// Not constexpr on purpose : calling it from ConstexprMap::Build stops the constant evaluation, so a bad table is a
+		// compile error in every configuration, unlike REX_CORE_ASSERT which compiles away with NDEBUG
+		inline void ConstexprMapBuildError(const char*) {}
+	}
+
+	// Hashes usable at compile time, StringView gives the same value as HeterogenousStringHash
+	template<typename T>
+	struct ConstexprHash;
+
+	template<typename T>
+		requires std::is_integral_v<T> || std::is_enum_v<T>
+	struct ConstexprHash<T>
+	{
+		[[nodiscard]] constexpr U64 operator()(T value) const
+		{
+			// Same as ankerl::unordered_dense::detail::wyhash::hash(uint64_t)
+			return Internal::ConstexprWyhash::Mix(static_cast<U64>(value), 0x9E3779B97F4A7C15llu);
+		}
+	};
+
+	template<>
+	struct ConstexprHash<StringView>
+	{
+		[[nodiscard]] constexpr U64 operator()(StringView str) const
+		{
+			return HashString(str);
+		}
+	};
+
+	// Read-only map with a minimal perfect hash built at compile time (PTHash style: the keys are split in buckets and
+	// each bucket gets a pilot value that sends all of its keys to free slots). Lookups hash once, read one pilot and
+	// compare a single key, without any allocation. Build it with MakeConstexprMap(), big tables might need to raise the
+	// compiler's constexpr step limit.
+	template<typename Key, typename Value, U64 N, typename Hash = ConstexprHash<Key>>
+	class ConstexprMap
+	{
+	public:
+		using ItemType = std::pair<Key, Value>;
+		using ConstIterator = const ItemType*;
+
+		static_assert(N > 0 && N < Math::MaxValue<U32>(), "A ConstexprMap needs between 1 and 2^32 items");
+		static_assert(std::is_default_constructible_v<Key> && std::is_default_constructible_v<Value>, "ConstexprMap keys and values must be default constructible");
+
+		consteval explicit ConstexprMap(const ItemType (&items)[N])
+		{
+			Build(items);
+		}
+
+		[[nodiscard]] constexpr U64 Size() const { return N; }
+
+		// Will return End() if not found
+		[[nodiscard]] constexpr ConstIterator Find(const Key& key) const
+		{
+			const U64 hash = Hash{}(key);
+			const ItemType& item = m_items[SlotIndex(hash, m_pilots[BucketIndex(hash)])];
+			return item.first == key ? &item : End();
+		}
+
+		[[nodiscard]] constexpr bool Contains(const Key& key) const { return Find(key) != End(); }
+
+		[[nodiscard]] constexpr const Value& At(const Key& key) const
+		{
+			const ConstIterator found = Find(key);
+			REX_CORE_ASSERT(found != End(), "Value not found ! use Find() instead");
+			return found->second;
+		}
+
+		[[nodiscard]] constexpr ConstIterator Begin() const { return m_items.data(); }
+		[[nodiscard]] constexpr ConstIterator End() const { return m_items.data() + N; }
+		[[nodiscard]] constexpr ConstIterator CBegin() const { return Begin(); }
+		[[nodiscard]] constexpr ConstIterator CEnd() const { return End(); }
+
+	public:
+		[[nodiscard]] constexpr ConstIterator begin() const { return Begin(); }
+		[[nodiscard]] constexpr ConstIterator end() const { return End(); }
+		[[nodiscard]] constexpr ConstIterator cbegin() const { return CBegin(); }
+		[[nodiscard]] constexpr ConstIterator cend() const { return CEnd(); }
+
+	private:
+		// Around 2 keys per bucket, more buckets make the build faster at the cost of 8 bytes per bucket
+		constexpr static U64 NumBuckets = (N + 1) / 2;
+		constexpr static U64 MaxPilotAttempts = 1llu << 20llu;
+
+		[[nodiscard]] constexpr static U64 Mix(U64 a, U64 b)
+		{
+			if (std::is_constant_evaluated())
+				return Internal::ConstexprWyhash::Mix(a, b);
+			return ankerl::unordered_dense::detail::wyhash::mix(a, b);
+		}
+
+		// Maps a 32 bits value to [0, range) with a multiplication instead of a modulo
+		[[nodiscard]] constexpr static U64 FastRange(U64 value, U64 range)
+		{
+			return ((value & 0xFFFFFFFFllu) * range) >> 32llu;
+		}
+
+		[[nodiscard]] constexpr static U64 BucketIndex(U64 hash) { return FastRange(hash >> 32llu, NumBuckets); }
+		[[nodiscard]] constexpr static U64 SlotIndex(U64 hash, U64 pilot) { return FastRange(Mix(hash, pilot), N); }
+		[[nodiscard]] constexpr static U64 PilotValue(U64 attempt) { return Mix(attempt, 0xe7037ed1a0b428dbllu) | 1llu; }
+
+		consteval void Build(const ItemType (&items)[N])
+		{
+			std::array<U64, N> hashes{};
+			std::array<U32, N> order{}; // Item indices sorted by bucket, biggest buckets first
+			std::array<U32, NumBuckets> bucketSizes{};
+			for (U32 i = 0; i < N; i++)
+			{
+				hashes[i] = Hash{}(items[i].first);
+				bucketSizes[BucketIndex(hashes[i])]++;
+				order[i] = i;
+			}
+
+			std::sort(order.begin(), order.end(), [&](U32 a, U32 b) {
+				const U64 bucketA = BucketIndex(hashes[a]);
+				const U64 bucketB = BucketIndex(hashes[b]);
+				if (bucketSizes[bucketA] != bucketSizes[bucketB])
+					return bucketSizes[bucketA] > bucketSizes[bucketB];
+				return bucketA != bucketB ? bucketA < bucketB : a < b;
+			});
+
+			std::array<bool, N> taken{};
+			for (U64 start = 0; start < N;)
+			{
+				const U64 bucket = BucketIndex(hashes[order[start]]);
+				const U64 end = start + bucketSizes[bucket];
+
+				for (U64 i = start; i < end; i++)
+				{
+					for (U64 j = i + 1; j < end; j++)
+					{
+						if (items[order[i]].first == items[order[j]].first)
+							Internal::ConstexprMapBuildError("Duplicate key in ConstexprMap");
+					}
+				}
+
+				bool found = false;
+				for (U64 attempt = 0; attempt < MaxPilotAttempts && !found; attempt++)
+				{
+					const U64 pilot = PilotValue(attempt);
+					found = true;
+					for (U64 i = start; i < end && found; i++)
+					{
+						const U64 slot = SlotIndex(hashes[order[i]], pilot);
+						found = !taken[slot];
+						for (U64 j = start; j < i && found; j++)
+							found = SlotIndex(hashes[order[j]], pilot) != slot;
+					}
+
+					if (found)
+					{
+						m_pilots[bucket] = pilot;
+						for (U64 i = start; i < end; i++)
+						{
+							const U64 slot = SlotIndex(hashes[order[i]], pilot);
+							taken[slot] = true;
+							m_items[slot] = items[order[i]];
+						}
+					}
+				}
+				if (!found)
+					Internal::ConstexprMapBuildError("Could not build the perfect hash");
+
+				start = end;
+			}
+		}
+
+	private:
+		std::array<ItemType, N> m_items{};
+		std::array<U64, NumBuckets> m_pilots{};
+	};
+
+	// constexpr auto map = MakeConstexprMap<StringView, U32>({ { "a", 1 }, { "b", 2 } });
+	template<typename Key, typename Value, typename Hash = ConstexprHash<Key>, U64 N>
+	[[nodiscard]] consteval ConstexprMap<Key, Value, N, Hash> MakeConstexprMap(const std::pair<Key, Value> (&items)[N])
+	{
+		return ConstexprMap<Key, Value, N, Hash>(items);
+	}
+}
@@ -0,0 +1,444 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/algorithms.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/simd.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/span.hpp>
+
+#include <rexcore/vendors/unordered_dense.hpp>
+
+#include <bit>
+#include <optional>
+
+namespace RexCore
+{
+	namespace Internal
+	{
+		// Same 64 bit hash as the HashMap buckets : the hash is used as is when it avalanches, mixed with wyhash otherwise
+		template<typename Hash, typename Key>
+		[[nodiscard]] U64 FilterHash(const Key& key)
+		{
+			if constexpr (requires { typename Hash::is_avalanching; })
+			{
+				if constexpr (sizeof(decltype(Hash{}(key))) < sizeof(U64))
+					return static_cast<U64>(Hash{}(key)) * 0x9ddfea08eb382d69llu;
+				else
+					return static_cast<U64>(Hash{}(key));
+			}
+			else
+			{
+				return ankerl::unordered_dense::detail::wyhash::hash(static_cast<U64>(Hash{}(key)));
+			}
+		}
+
+		// Prefix of the serialized filters, 32 bytes so the data that follows keeps the alignment of the buffer
+		struct FilterHeader
+		{
+			U32 magic = 0;
+			U32 version = 0;
+			U64 seed = 0;
+			U64 size = 0;
+			U64 padding = 0;
+		};
+		static_assert(sizeof(FilterHeader) == 32);
+
+		constexpr U32 FilterVersion = 1;
+
+		[[nodiscard]] inline std::optional<FilterHeader> ReadFilterHeader(BigSpan<Byte> buffer, U32 magic)
+		{
+			if (buffer.Size() < sizeof(FilterHeader))
+				return std::nullopt;
+
+			FilterHeader header;
+			MemCopy(buffer.Data(), &header, sizeof(FilterHeader));
+			if (header.magic != magic || header.version != FilterVersion)
+				return std::nullopt;
+			return header;
+		}
+
+		// 256 bits of a split block Bloom filter, a key sets one bit in each of the 8 words
+		struct alignas(32) BloomBlock
+		{
+			U32 words[8] = {};
+		};
+
+		constexpr U32 BloomSalts[8] = { 0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du, 0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u };
+
+		[[nodiscard]] inline U64 BloomBlockIndex(U64 hash, U64 numBlocks)
+		{
+			return ((hash >> 32llu) * numBlocks) >> 32llu;
+		}
+
+		inline void BloomBlockInsert(BloomBlock& block, U32 key)
+		{
+#if defined(REX_CORE_AVX2)
+			const __m256i salts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(BloomSalts));
+			const __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<S32>(key)), salts), 27);
+			const __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+			__m256i* words = reinterpret_cast<__m256i*>(block.words);
+			_mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), mask));
+#else
+			for (U32 i = 0; i < 8; i++)
+				block.words[i] |= 1u << ((key * BloomSalts[i]) >> 27u);
+#endif
+		}
+
+		[[nodiscard]] inline bool BloomBlockContains(const BloomBlock& block, U32 key)
+		{
+#if defined(REX_CORE_AVX2)
+			const __m256i salts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(BloomSalts));
+			const __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<S32>(key)), salts), 27);
+			const __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+			return _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(block.words)), mask) != 0;
+#else
+			U32 missing = 0;
+			for (U32 i = 0; i < 8; i++)
+				missing |= ~block.words[i] & (1u << ((key * BloomSalts[i]) >> 27u));
+			return missing == 0;
+#endif
+		}
+
+		// The 3 slots of a key in a xor filter, one in each third of the fingerprints
+		struct XorSlots
+		{
+			U32 slots[3];
+		};
+
+		[[nodiscard]] inline U64 XorFilterMix(U64 hash, U64 seed)
+		{
+			return ankerl::unordered_dense::detail::wyhash::mix(hash, seed);
+		}
+
+		[[nodiscard]] inline XorSlots XorFilterSlots(U64 mixed, U32 blockLength)
+		{
+			const auto reduce = [blockLength](U64 value) { return static_cast<U32>((static_cast<U64>(static_cast<U32>(value)) * blockLength) >> 32llu); };
+			return { { reduce(mixed), reduce(std::rotl(mixed, 21)) + blockLength, reduce(std::rotl(mixed, 42)) + 2 * blockLength } };
+		}
+
+		[[nodiscard]] inline U8 XorFingerprint(U64 mixed)
+		{
+			return static_cast<U8>(mixed ^ (mixed >> 32llu));
+		}
+	}
+
+	// Read only Bloom filter over blocks owned by someone else, for instance a BloomFilter serialized in a mapped file
+	template<typename Key, typename Hash = ankerl::unordered_dense::hash<Key>>
+	class BloomFilterView
+	{
+	public:
+		constexpr static U32 Magic = 0x46425852; // "RXBF"
+
+		BloomFilterView() = default;
+
+		BloomFilterView(const Internal::BloomBlock* blocks, U64 numBlocks)
+			: m_blocks(blocks), m_numBlocks(numBlocks)
+		{}
+
+		// Views the output of BloomFilter::Serialize(), nullopt if the buffer doesn't hold a serialized BloomFilter.
+		// The buffer must be aligned on 32 bytes and outlive the view, the Hash must be the one used to build the filter.
+		[[nodiscard]] static std::optional<BloomFilterView> FromBuffer(BigSpan<Byte> buffer)
+		{
+			const std::optional<Internal::FilterHeader> header = Internal::ReadFilterHeader(buffer, Magic);
+			// Checked by division, a corrupt size could overflow the byte count
+			if (!header || header->size > (buffer.Size() - sizeof(Internal::FilterHeader)) / sizeof(Internal::BloomBlock))
+				return std::nullopt;
+
+			// The blocks are read with aligned loads, the buffer must be aligned on 32 bytes
+			if (reinterpret_cast<U64>(buffer.Data()) % alignof(Internal::BloomBlock) != 0)
+				return std::nullopt;
+
+			return BloomFilterView(reinterpret_cast<const Internal::BloomBlock*>(buffer.Data() + sizeof(Internal::FilterHeader)), header->size);
+		}
+
+		[[nodiscard]] bool Contains(const auto& key) const { return ContainsHash(Internal::FilterHash<Hash>(key)); }
+
+		// False positives are possible, false negatives are not
+		[[nodiscard]] bool ContainsHash(U64 hash) const
+		{
+			if (m_numBlocks == 0)
+				return false;
+			return Internal::BloomBlockContains(m_blocks[Internal::BloomBlockIndex(hash, m_numBlocks)], static_cast<U32>(hash));
+		}
+
+		[[nodiscard]] U64 NumBlocks() const { return m_numBlocks; }
+		[[nodiscard]] U64 SizeInBytes() const { return m_numBlocks * sizeof(Internal::BloomBlock); }
+
+	private:
+		const Internal::BloomBlock* m_blocks = nullptr;
+		U64 m_numBlocks = 0;
+	};
+
+	// Split block Bloom filter : each key maps to one 32 bytes block and sets one bit in each of its 8 words, so a lookup
+	// touches a single cache line and is a few AVX2 instructions. With 10 bits per key about 1% of the absent keys are
+	// reported present, 0.2% with 16 bits per key. Keys can be added at any time but not removed.
+	template<typename Key, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>>
+	class BloomFilter
+	{
+	public:
+		using View = BloomFilterView<Key, Hash>;
+
+		REX_CORE_NO_COPY(BloomFilter);
+		REX_CORE_DEFAULT_MOVE(BloomFilter);
+
+		explicit BloomFilter(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_blocks(allocator)
+		{}
+
+		explicit BloomFilter(U64 expectedItems, U32 bitsPerKey = 10, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_blocks(allocator)
+		{
+			Reset(expectedItems, bitsPerKey);
+		}
+
+		// Drops all the keys and sizes the filter for expectedItems
+		void Reset(U64 expectedItems, U32 bitsPerKey = 10)
+		{
+			const U64 numBlocks = Math::Max<U64>(1, Math::CeilDiv<U64>(expectedItems * bitsPerKey, sizeof(Internal::BloomBlock) * 8));
+			m_blocks.Clear();
+			m_blocks.Resize(static_cast<U32>(numBlocks));
+		}
+
+		void Insert(const auto& key) { InsertHash(Internal::FilterHash<Hash>(key)); }
+
+		void InsertHash(U64 hash)
+		{
+			REX_CORE_ASSERT(!m_blocks.IsEmpty(), "The filter must be sized before inserting");
+			Internal::BloomBlockInsert(m_blocks[static_cast<U32>(Internal::BloomBlockIndex(hash, m_blocks.Size()))], static_cast<U32>(hash));
+		}
+
+		[[nodiscard]] bool Contains(const auto& key) const { return GetView().Contains(key); }
+		[[nodiscard]] bool ContainsHash(U64 hash) const { return GetView().ContainsHash(hash); }
+
+		// Keeps the size
+		void Clear()
+		{
+			if (!m_blocks.IsEmpty())
+				MemSet(m_blocks.Data(), 0, m_blocks.Size() * sizeof(Internal::BloomBlock));
+		}
+
+		[[nodiscard]] U64 NumBlocks() const { return m_blocks.Size(); }
+		[[nodiscard]] U64 SizeInBytes() const { return m_blocks.Size() * sizeof(Internal::BloomBlock); }
+
+		[[nodiscard]] View GetView() const { return View(m_blocks.Data(), m_blocks.Size()); }
+		[[nodiscard]] operator View() const { return GetView(); }
+
+		// A header followed by the blocks, BloomFilterView::FromBuffer() reads it back without copying
+		[[nodiscard]] U64 SerializedSize() const { return sizeof(Internal::FilterHeader) + SizeInBytes(); }
+
+		void Serialize(Byte* dest) const
+		{
+			Internal::FilterHeader header;
+			header.magic = View::Magic;
+			header.version = Internal::FilterVersion;
+			header.size = m_blocks.Size();
+			MemCopy(&header, dest, sizeof(Internal::FilterHeader));
+			if (!m_blocks.IsEmpty())
+				MemCopy(m_blocks.Data(), dest + sizeof(Internal::FilterHeader), SizeInBytes());
+		}
+
+		[[nodiscard]] AllocatorRef<Allocator> GetAllocator() const { return m_blocks.GetAllocator(); }
+
+	private:
+		Vector<Internal::BloomBlock, Allocator> m_blocks;
+	};
+
+	// Read only xor filter over fingerprints owned by someone else, for instance a XorFilter serialized in a mapped file
+	template<typename Key, typename Hash = ankerl::unordered_dense::hash<Key>>
+	class XorFilterView
+	{
+	public:
+		constexpr static U32 Magic = 0x46585852; // "RXXF"
+
+		XorFilterView() = default;
+
+		XorFilterView(const U8* fingerprints, U32 blockLength, U64 seed)
+			: m_fingerprints(fingerprints), m_blockLength(blockLength), m_seed(seed)
+		{}
+
+		// Views the output of XorFilter::Serialize(), nullopt if the buffer doesn't hold a serialized XorFilter.
+		// The buffer must outlive the view, the Hash must be the one used to build the filter.
+		[[nodiscard]] static std::optional<XorFilterView> FromBuffer(BigSpan<Byte> buffer)
+		{
+			const std::optional<Internal::FilterHeader> header = Internal::ReadFilterHeader(buffer, Magic);
+			if (!header || header->size > Math::MaxValue<U32>() || buffer.Size() < sizeof(Internal::FilterHeader) + header->size * 3)
+				return std::nullopt;
+
+			return XorFilterView(buffer.Data() + sizeof(Internal::FilterHeader), static_cast<U32>(header->size), header->seed);
+		}
+
+		[[nodiscard]] bool Contains(const auto& key) const { return ContainsHash(Internal::FilterHash<Hash>(key)); }
+
+		// False positives are possible, false negatives are not
+		[[nodiscard]] bool ContainsHash(U64 hash) const
+		{
+			if (m_blockLength == 0)
+				return false;
+
+			const U64 mixed = Internal::XorFilterMix(hash, m_seed);
+			const Internal::XorSlots slots = Internal::XorFilterSlots(mixed, m_blockLength);
+			const U8 fingerprint = m_fingerprints[slots.slots[0]] ^ m_fingerprints[slots.slots[1]] ^ m_fingerprints[slots.slots[2]];
+			return fingerprint == Internal::XorFingerprint(mixed);
+		}
+
+		[[nodiscard]] U64 SizeInBytes() const { return static_cast<U64>(m_blockLength) * 3; }
+
+	private:
+		const U8* m_fingerprints = nullptr;
+		U32 m_blockLength = 0;
+		U64 m_seed = 0;
+	};
+
+	// Xor filter with 8 bit fingerprints for sets known up front : about 9.84 bits per key for 0.4% of false positives,
+	// and a lookup is 3 independent byte loads. Build() peels the keys over 3 slots each and retries with another seed
+	// in the rare case it fails, it can't be modified afterwards.
+	template<typename Key, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>>
+	class XorFilter
+	{
+	public:
+		using View = XorFilterView<Key, Hash>;
+
+		REX_CORE_NO_COPY(XorFilter);
+		REX_CORE_DEFAULT_MOVE(XorFilter);
+
+		explicit XorFilter(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_fingerprints(allocator)
+		{}
+
+		// Duplicated keys are allowed
+		void Build(Span<Key> keys)
+		{
+			Vector<U64, Allocator> hashes(m_fingerprints.GetAllocator());
+			hashes.Reserve(keys.Size());
+			for (const Key& key : keys)
+				hashes.PushBack(Internal::FilterHash<Hash>(key));
+			BuildFromHashes(std::move(hashes));
+		}
+
+		// Takes the hashes by value since they are sorted to remove the duplicates
+		void BuildFromHashes(Vector<U64, Allocator> hashes)
+		{
+			REX_CORE_TRACE_FUNC();
+			Sort(hashes);
+			hashes.Resize(static_cast<U32>(std::unique(hashes.begin(), hashes.end()) - hashes.begin()));
+
+			const U32 numKeys = hashes.Size();
+			m_fingerprints.Clear();
+			if (numKeys == 0)
+			{
+				m_blockLength = 0;
+				return;
+			}
+
+			m_blockLength = static_cast<U32>((32 + static_cast<U64>(1.23 * numKeys) + 2) / 3);
+			const U32 capacity = m_blockLength * 3;
+			m_fingerprints.Resize(capacity);
+
+			Vector<U64, Allocator> xorMasks(m_fingerprints.GetAllocator()); // Xor of the hashes of the keys in each slot
+			Vector<U32, Allocator> counts(m_fingerprints.GetAllocator());
+			Vector<U32, Allocator> queue(m_fingerprints.GetAllocator());
+			Vector<U64, Allocator> peeledHashes(m_fingerprints.GetAllocator());
+			Vector<U32, Allocator> peeledSlots(m_fingerprints.GetAllocator());
+			queue.Reserve(capacity);
+			peeledHashes.Reserve(numKeys);
+			peeledSlots.Reserve(numKeys);
+
+			U64 seedState = 0x726578636f726531llu;
+			while (true)
+			{
+				m_seed = ankerl::unordered_dense::detail::wyhash::hash(seedState++);
+
+				xorMasks.Clear();
+				xorMasks.Resize(capacity);
+				counts.Clear();
+				counts.Resize(capacity);
+				for (const U64 hash : hashes)
+				{
+					const U64 mixed = Internal::XorFilterMix(hash, m_seed);
+					const Internal::XorSlots slots = Internal::XorFilterSlots(mixed, m_blockLength);
+					for (const U32 slot : slots.slots)
+					{
+						xorMasks[slot] ^= mixed;
+						counts[slot]++;
+					}
+				}
+
+				// Peel the slots holding a single key until none is left, the keys are assigned in the reverse order
+				queue.Clear();
+				for (U32 slot = 0; slot < capacity; slot++)
+				{
+					if (counts[slot] == 1)
+						queue.PushBack(slot);
+				}
+
+				peeledHashes.Clear();
+				peeledSlots.Clear();
+				while (!queue.IsEmpty())
+				{
+					const U32 slot = queue.PopBack();
+					if (counts[slot] != 1)
+						continue;
+
+					const U64 mixed = xorMasks[slot];
+					peeledHashes.PushBack(mixed);
+					peeledSlots.PushBack(slot);
+					const Internal::XorSlots slots = Internal::XorFilterSlots(mixed, m_blockLength);
+					for (const U32 other : slots.slots)
+					{
+						xorMasks[other] ^= mixed;
+						counts[other]--;
+						if (counts[other] == 1)
+							queue.PushBack(other);
+					}
+				}
+
+				if (peeledHashes.Size() == numKeys)
+					break;
+			}
+
+			for (U32 i = numKeys; i-- > 0;)
+			{
+				const U64 mixed = peeledHashes[i];
+				const Internal::XorSlots slots = Internal::XorFilterSlots(mixed, m_blockLength);
+				U8 fingerprint = Internal::XorFingerprint(mixed);
+				for (const U32 slot : slots.slots)
+				{
+					if (slot != peeledSlots[i])
+						fingerprint ^= m_fingerprints[slot];
+				}
+				m_fingerprints[peeledSlots[i]] = fingerprint;
+			}
+		}
+
+		[[nodiscard]] bool Contains(const auto& key) const { return GetView().Contains(key); }
+		[[nodiscard]] bool ContainsHash(U64 hash) const { return GetView().ContainsHash(hash); }
+
+		[[nodiscard]] U64 SizeInBytes() const { return m_fingerprints.Size(); }
+
+		[[nodiscard]] View GetView() const { return View(m_fingerprints.Data(), m_blockLength, m_seed); }
+		[[nodiscard]] operator View() const { return GetView(); }
+
+		// A header followed by the fingerprints, XorFilterView::FromBuffer() reads it back without copying
+		[[nodiscard]] U64 SerializedSize() const { return sizeof(Internal::FilterHeader) + SizeInBytes(); }
+
+		void Serialize(Byte* dest) const
+		{
+			Internal::FilterHeader header;
+			header.magic = View::Magic;
+			header.version = Internal::FilterVersion;
+			header.seed = m_seed;
+			header.size = m_blockLength;
+			MemCopy(&header, dest, sizeof(Internal::FilterHeader));
+			if (!m_fingerprints.IsEmpty())
+				MemCopy(m_fingerprints.Data(), dest + sizeof(Internal::FilterHeader), SizeInBytes());
+		}
+
+		[[nodiscard]] AllocatorRef<Allocator> GetAllocator() const { return m_fingerprints.GetAllocator(); }
+
+	private:
+		Vector<U8, Allocator> m_fingerprints;
+		U32 m_blockLength = 0;
+		U64 m_seed = 0;
+	};
+}
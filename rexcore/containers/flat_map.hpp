@@ -0,0 +1,405 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/algorithms.hpp>
+#include <rexcore/concepts.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/simd.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/span.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <utility>
+
+namespace RexCore
+{
+	namespace Internal
+	{
+		// Copy of sorted keys in the Eytzinger (BFS) layout : the children of the node k are 2k and 2k + 1 (1-based).
+		// The first levels of the tree share a few cache lines and the next levels can be prefetched, which makes it
+		// faster than a binary search on the sorted array once it doesn't fit in the cache.
+		template<typename Key, IAllocator Allocator>
+		class EytzingerIndex
+		{
+		public:
+			REX_CORE_NO_COPY(EytzingerIndex);
+			REX_CORE_DEFAULT_MOVE(EytzingerIndex);
+
+			explicit EytzingerIndex(AllocatorRef<Allocator> allocator)
+				: m_keys(allocator), m_ranks(allocator)
+			{}
+
+			[[nodiscard]] bool IsBuilt() const { return !m_keys.IsEmpty(); }
+
+			void Build(Span<Key> sortedKeys)
+			{
+				REX_CORE_TRACE_FUNC();
+				Clear();
+				if (sortedKeys.IsEmpty())
+					return;
+
+				// Sorted index of each node, filled with an in-order traversal
+				m_ranks.Resize(sortedKeys.Size());
+				U32 rank = 0;
+				FillRanks(1, rank);
+
+				m_keys.Reserve(sortedKeys.Size());
+				for (const U32 sortedIndex : m_ranks)
+					m_keys.EmplaceBack(RexCore::Clone(sortedKeys[sortedIndex]));
+			}
+
+			void Clear()
+			{
+				m_keys.Clear();
+				m_ranks.Clear();
+			}
+
+			// Same result as LowerBound() on the sorted keys
+			template<typename K, typename Compare>
+			[[nodiscard]] U32 LowerBound(const K& key, Compare comp) const
+			{
+				const U64 size = m_keys.Size();
+				const Key* keys = m_keys.Data();
+				U64 k = 1;
+				while (k <= size)
+				{
+					if (k * PrefetchStride <= size)
+						Prefetch(keys + k * PrefetchStride - 1); // First descendant of k a few levels below
+					k = 2 * k + (comp(keys[k - 1], key) ? 1 : 0);
+				}
+
+				// Going right means the node is before key, drop the trailing right turns to get back to the last left turn
+				k >>= std::countr_one(k) + 1;
+				return k == 0 ? static_cast<U32>(size) : m_ranks[static_cast<U32>(k - 1)];
+			}
+
+		private:
+			// The descendants of a node n levels below are 2^n contiguous nodes, prefetch the level where they fill a cache line
+			constexpr static U64 PrefetchStride = Math::Max<U64>(64 / sizeof(Key), 1);
+
+			void FillRanks(U64 k, U32& rank)
+			{
+				if (k > m_ranks.Size())
+					return;
+
+				FillRanks(2 * k, rank);
+				m_ranks[static_cast<U32>(k - 1)] = rank++;
+				FillRanks(2 * k + 1, rank);
+			}
+
+		private:
+			Vector<Key, Allocator> m_keys;
+			Vector<U32, Allocator> m_ranks;
+		};
+
+		// Sorted unique keys shared by FlatSet and FlatMap
+		template<typename Key, IAllocator Allocator, typename Compare>
+		class FlatKeys
+		{
+		public:
+			REX_CORE_NO_COPY(FlatKeys);
+			REX_CORE_DEFAULT_MOVE(FlatKeys);
+
+			explicit FlatKeys(AllocatorRef<Allocator> allocator)
+				: m_keys(allocator), m_eytzinger(allocator)
+			{}
+
+			[[nodiscard]] U32 Size() const { return m_keys.Size(); }
+			[[nodiscard]] bool IsEmpty() const { return m_keys.IsEmpty(); }
+			[[nodiscard]] Span<Key> GetKeys() const { return m_keys; }
+			[[nodiscard]] const Key& GetKey(U32 index) const { return m_keys[index]; }
+			[[nodiscard]] AllocatorRef<Allocator> GetAllocator() const { return m_keys.GetAllocator(); }
+
+			// Index of the first key not ordered before key, Size() if there is none
+			template<typename K>
+			[[nodiscard]] U32 LowerBound(const K& key) const
+			{
+				if (m_eytzinger.IsBuilt())
+					return m_eytzinger.LowerBound(key, Compare{});
+				return static_cast<U32>(RexCore::LowerBound(m_keys.Data(), m_keys.Size(), key, Compare{}));
+			}
+
+			// Index of the first key ordered after key, Size() if there is none
+			template<typename K>
+			[[nodiscard]] U32 UpperBound(const K& key) const
+			{
+				return static_cast<U32>(RexCore::UpperBound(m_keys.Data(), m_keys.Size(), key, Compare{}));
+			}
+
+			// Will return Size() if not found
+			template<typename K>
+			[[nodiscard]] U32 Find(const K& key) const
+			{
+				const U32 index = LowerBound(key);
+				return index < m_keys.Size() && !Compare{}(key, m_keys[index]) ? index : m_keys.Size();
+			}
+
+			template<typename K>
+			[[nodiscard]] bool Contains(const K& key) const { return Find(key) != m_keys.Size(); }
+
+			// Indices [begin, end) of the keys in [first, last)
+			template<typename K>
+			[[nodiscard]] std::pair<U32, U32> Range(const K& first, const K& last) const
+			{
+				const U32 begin = LowerBound(first);
+				return { begin, Math::Max(begin, LowerBound(last)) };
+			}
+
+			// Lookups use a copy of the keys in the Eytzinger layout until the next modification,
+			// for big tables that are searched much more often than they are modified
+			void BuildEytzingerIndex() { m_eytzinger.Build(m_keys); }
+			[[nodiscard]] bool HasEytzingerIndex() const { return m_eytzinger.IsBuilt(); }
+
+		protected:
+			// Sorts the keys and returns the permutation to apply to the values, duplicate keys keep their last occurrence
+			[[nodiscard]] Vector<U32, Allocator> SortUniqueKeys(Vector<Key, Allocator>&& keys)
+			{
+				REX_CORE_TRACE_FUNC();
+				Vector<U32, Allocator> order(keys.GetAllocator());
+				order.Reserve(keys.Size());
+				for (U32 i = 0; i < keys.Size(); i++)
+					order.EmplaceBack(i);
+
+				std::stable_sort(order.Begin(), order.End(), [&](U32 a, U32 b) { return Compare{}(keys[a], keys[b]); });
+
+				U32 unique = 0;
+				for (U32 i = 0; i < order.Size(); i++)
+				{
+					const bool lastOfRun = i + 1 == order.Size() || Compare{}(keys[order[i]], keys[order[i + 1]]);
+					if (lastOfRun)
+						order[unique++] = order[i];
+				}
+				order.Resize(unique);
+
+				m_keys.Clear();
+				m_keys.Reserve(unique);
+				for (const U32 index : order)
+					m_keys.EmplaceBack(std::move(keys[index]));
+				m_eytzinger.Clear();
+				return order;
+			}
+
+			template<typename K>
+			void InsertKey(U32 index, K&& key)
+			{
+				m_keys.EmplaceAt(index, std::forward<K>(key));
+				m_eytzinger.Clear();
+			}
+
+			void EraseKey(U32 index)
+			{
+				m_keys.RemoveAtOrdered(index);
+				m_eytzinger.Clear();
+			}
+
+			void ClearKeys()
+			{
+				m_keys.Clear();
+				m_eytzinger.Clear();
+			}
+
+			void ReserveKeys(U32 size) { m_keys.Reserve(size); }
+
+		private:
+			Vector<Key, Allocator> m_keys;
+			EytzingerIndex<Key, Allocator> m_eytzinger;
+		};
+	}
+
+	// Sorted set stored in a Vector, lookups are binary searches and inserts/erases shift the following keys.
+	// Faster than HashSet for small sets and when the keys are iterated in order or searched by range.
+	template<typename Key, IAllocator Allocator = DefaultAllocator, typename Compare = std::less<>>
+	class FlatSet : public Internal::FlatKeys<Key, Allocator, Compare>
+	{
+	private:
+		using Base = Internal::FlatKeys<Key, Allocator, Compare>;
+
+	public:
+		using ConstIterator = const Key*;
+
+		REX_CORE_NO_COPY(FlatSet);
+		REX_CORE_DEFAULT_MOVE(FlatSet);
+
+		FlatSet(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: Base(allocator)
+		{}
+
+		// Sorts the keys and removes the duplicates once, instead of inserting them one by one
+		[[nodiscard]] static FlatSet BulkBuild(Vector<Key, Allocator>&& keys)
+		{
+			FlatSet set(keys.GetAllocator());
+			[[maybe_unused]] const Vector<U32, Allocator> order = set.SortUniqueKeys(std::move(keys));
+			return set;
+		}
+
+		void Reserve(U32 size) { Base::ReserveKeys(size); }
+
+		// Returns false if the key was already there
+		template<typename K>
+		bool Insert(K&& key)
+		{
+			const U32 index = Base::LowerBound(key);
+			if (index < Base::Size() && !Compare{}(key, Base::GetKey(index)))
+				return false;
+
+			Base::InsertKey(index, std::forward<K>(key));
+			return true;
+		}
+
+		template<typename K>
+		bool Erase(const K& key)
+		{
+			const U32 index = Base::Find(key);
+			if (index == Base::Size())
+				return false;
+
+			Base::EraseKey(index);
+			return true;
+		}
+
+		void Clear() { Base::ClearKeys(); }
+
+		[[nodiscard]] ConstIterator Begin() const { return Base::GetKeys().Begin(); }
+		[[nodiscard]] ConstIterator End() const { return Base::GetKeys().End(); }
+
+	public:
+		[[nodiscard]] ConstIterator begin() const { return Begin(); }
+		[[nodiscard]] ConstIterator end() const { return End(); }
+	};
+
+	// Sorted map with the keys and the values in separate Vectors, the searches only touch the keys.
+	// Lookups return indices in the sorted order, Size() when not found.
+	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Compare = std::less<>>
+	class FlatMap : public Internal::FlatKeys<Key, Allocator, Compare>
+	{
+	private:
+		using Base = Internal::FlatKeys<Key, Allocator, Compare>;
+
+	public:
+		REX_CORE_NO_COPY(FlatMap);
+		REX_CORE_DEFAULT_MOVE(FlatMap);
+
+		FlatMap(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: Base(allocator), m_values(allocator)
+		{}
+
+		// Sorts the keys and removes the duplicates once, values[i] belongs to keys[i] and the last duplicate wins
+		[[nodiscard]] static FlatMap BulkBuild(Vector<Key, Allocator>&& keys, Vector<Value, Allocator>&& values)
+		{
+			REX_CORE_ASSERT(keys.Size() == values.Size());
+			FlatMap map(keys.GetAllocator());
+			const Vector<U32, Allocator> order = map.SortUniqueKeys(std::move(keys));
+
+			map.m_values.Reserve(order.Size());
+			for (const U32 index : order)
+				map.m_values.EmplaceBack(std::move(values[index]));
+			return map;
+		}
+
+		[[nodiscard]] Span<Value> GetValues() const { return m_values; }
+		[[nodiscard]] Value& GetValue(U32 index) { return m_values[index]; }
+		[[nodiscard]] const Value& GetValue(U32 index) const { return m_values[index]; }
+
+		// Will return nullptr if not found
+		template<typename K>
+		[[nodiscard]] Value* TryFind(const K& key)
+		{
+			const U32 index = Base::Find(key);
+			return index == Base::Size() ? nullptr : &m_values[index];
+		}
+
+		template<typename K>
+		[[nodiscard]] const Value* TryFind(const K& key) const
+		{
+			const U32 index = Base::Find(key);
+			return index == Base::Size() ? nullptr : &m_values[index];
+		}
+
+		template<typename K>
+		Value& At(const K& key)
+		{
+			Value* found = TryFind(key);
+			REX_CORE_ASSERT(found != nullptr, "Value not found ! use TryFind() instead");
+			return *found;
+		}
+
+		template<typename K>
+		const Value& At(const K& key) const
+		{
+			const Value* found = TryFind(key);
+			REX_CORE_ASSERT(found != nullptr, "Value not found ! use TryFind() instead");
+			return *found;
+		}
+
+		void Reserve(U32 size)
+		{
+			Base::ReserveKeys(size);
+			m_values.Reserve(size);
+		}
+
+		// Returns false if the key was already there, its value is left untouched
+		template<typename K, typename ...Args>
+		bool Insert(K&& key, Args&& ...args)
+		{
+			const U32 index = Base::LowerBound(key);
+			if (index < Base::Size() && !Compare{}(key, Base::GetKey(index)))
+				return false;
+
+			Base::InsertKey(index, std::forward<K>(key));
+			m_values.EmplaceAt(index, std::forward<Args>(args)...);
+			return true;
+		}
+
+		template<typename K, typename ...Args>
+		void InsertOrAssign(K&& key, Args&& ...args)
+		{
+			const U32 index = Base::LowerBound(key);
+			if (index < Base::Size() && !Compare{}(key, Base::GetKey(index)))
+			{
+				m_values[index] = Value(std::forward<Args>(args)...);
+				return;
+			}
+
+			Base::InsertKey(index, std::forward<K>(key));
+			m_values.EmplaceAt(index, std::forward<Args>(args)...);
+		}
+
+		template<typename K>
+		bool Erase(const K& key)
+		{
+			const U32 index = Base::Find(key);
+			if (index == Base::Size())
+				return false;
+
+			Base::EraseKey(index);
+			m_values.RemoveAtOrdered(index);
+			return true;
+		}
+
+		void Clear()
+		{
+			Base::ClearKeys();
+			m_values.Clear();
+		}
+
+		// Calls fn(const Key&, Value&) for each item in order
+		template<typename Fn>
+		void ForEach(Fn&& fn)
+		{
+			for (U32 i = 0; i < Base::Size(); i++)
+				fn(Base::GetKey(i), m_values[i]);
+		}
+
+		template<typename Fn>
+		void ForEach(Fn&& fn) const
+		{
+			for (U32 i = 0; i < Base::Size(); i++)
+				fn(Base::GetKey(i), m_values[i]);
+		}
+
+	private:
+		Vector<Value, Allocator> m_values;
+	};
+}
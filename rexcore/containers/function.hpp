@@ -6,6 +6,10 @@
 #include <rexcore/vendors/skarupke_function.hpp>
 #pragma warning(pop)
 
+#include <functional>
+#include <memory>
+#include <type_traits>
+
 namespace RexCore
 {
 	template<typename R, typename ...Args>
@@ -77,4 +81,69 @@ namespace RexCore
 	{
 		return lhs;
 	}
+
+	template<typename R, typename ...Args>
+	class FunctionRef;
+
+	// Non-owning reference to a callable, two pointers passed by value that never allocate nor copy the callee.
+	// For parameters of non-template functions and callbacks that don't outlive the call : a FunctionRef made from
+	// a temporary lambda is only valid until the end of the full expression, store a Function instead.
+	template<typename R, typename ...Args>
+	class FunctionRef<R(Args...)>
+	{
+	public:
+		template<typename T>
+			requires (!std::is_same_v<std::remove_cvref_t<T>, FunctionRef> && !std::is_function_v<std::remove_pointer_t<std::remove_cvref_t<T>>>
+				&& std::is_invocable_r_v<R, T&, Args...>)
+		constexpr FunctionRef(T&& functor) noexcept
+			: m_invoke(&InvokeObject<std::remove_reference_t<T>>)
+		{
+			m_callee.object = const_cast<void*>(static_cast<const void*>(std::addressof(functor)));
+		}
+
+		// Free functions are referenced by their address, so a function pointer doesn't need to outlive the FunctionRef
+		template<typename T>
+			requires (std::is_function_v<std::remove_pointer_t<std::remove_cvref_t<T>>> && std::is_invocable_r_v<R, T&, Args...>)
+		constexpr FunctionRef(T&& function) noexcept
+			: m_invoke(&InvokeFunction<std::remove_pointer_t<std::remove_cvref_t<T>>>)
+		{
+			auto* pointer = static_cast<std::remove_pointer_t<std::remove_cvref_t<T>>*>(function);
+			REX_CORE_ASSERT(pointer != nullptr);
+			m_callee.function = reinterpret_cast<void (*)()>(pointer);
+		}
+
+		constexpr R operator()(Args... args) const
+		{
+			return m_invoke(m_callee, std::forward<Args>(args)...);
+		}
+
+	private:
+		union Callee
+		{
+			void* object;
+			void (*function)();
+		};
+
+		template<typename T>
+		static R InvokeObject(Callee callee, Args... args)
+		{
+			if constexpr (std::is_void_v<R>)
+				std::invoke(*static_cast<T*>(callee.object), std::forward<Args>(args)...);
+			else
+				return std::invoke(*static_cast<T*>(callee.object), std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		static R InvokeFunction(Callee callee, Args... args)
+		{
+			if constexpr (std::is_void_v<R>)
+				std::invoke(reinterpret_cast<T*>(callee.function), std::forward<Args>(args)...);
+			else
+				return std::invoke(reinterpret_cast<T*>(callee.function), std::forward<Args>(args)...);
+		}
+
+	private:
+		Callee m_callee;
+		R (*m_invoke)(Callee, Args...);
+	};
 }
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/simd.hpp>
+#include <rexcore/containers/span.hpp>
+
+#include <type_traits>
+
+namespace RexCore::Internal
+{
+	constexpr U32 HashFindBatchSize = 32;
+
+	// FindBatch() of HashMap and HashSet. ImplT is the unordered_dense table, const to get const iterators, and OutputT an
+	// iterator of it or a bool for ContainsBatch().
+	template<typename ImplT, typename Key, typename OutputT>
+	void HashFindBatch(ImplT& impl, Span<Key> keys, OutputT* out)
+	{
+		REX_CORE_TRACE_FUNC();
+		U64 hashes[HashFindBatchSize];
+		for (U32 start = 0; start < keys.Size(); start += HashFindBatchSize)
+		{
+			const U32 count = Math::Min(HashFindBatchSize, keys.Size() - start);
+			const Key* batchKeys = keys.Data() + start;
+
+			for (U32 i = 0; i < count; i++)
+			{
+				hashes[i] = impl.hash_key(batchKeys[i]);
+				if (const void* bucket = impl.bucket_address(hashes[i]))
+					Prefetch(bucket);
+			}
+
+			for (U32 i = 0; i < count; i++)
+			{
+				if (const void* value = impl.value_address(hashes[i]))
+					Prefetch(value);
+			}
+
+			for (U32 i = 0; i < count; i++)
+			{
+				if constexpr (std::is_same_v<OutputT, bool>)
+					out[start + i] = impl.find_hashed(batchKeys[i], hashes[i]) != impl.end();
+				else
+					out[start + i] = impl.find_hashed(batchKeys[i], hashes[i]);
+			}
+		}
+	}
+}
@@ -0,0 +1,195 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/containers/map.hpp>
+
+#include <rexcore/vendors/unordered_dense.hpp>
+
+#include <utility>
+
+namespace RexCore
+{
+	// Hash map that never rehashes all of its items in a single insert. When the table is full it becomes the old table
+	// and a new one twice as big takes its place, every following insert then moves a few items from the old table to
+	// the new one until the old one is empty. Lookups check both tables while the items are being moved.
+	// The worst-case insert only allocates and clears the new buckets instead of reinserting every item,
+	// at the cost of having both tables alive during the move.
+	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>>
+	class IncrementalHashMap
+	{
+	public:
+		using MapType = SegmentedHashMap<Key, Value, Allocator, Hash>;
+
+		REX_CORE_NO_COPY(IncrementalHashMap);
+		REX_CORE_DEFAULT_MOVE(IncrementalHashMap);
+
+		IncrementalHashMap(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_map(allocator), m_oldMap(allocator)
+		{}
+
+		[[nodiscard]] U64 Size() const { return m_map.Size() + m_oldMap.Size(); }
+		[[nodiscard]] bool IsEmpty() const { return Size() == 0; }
+
+		// True while items are still being moved from the old table
+		[[nodiscard]] bool IsRehashing() const { return !m_oldMap.IsEmpty(); }
+
+		// Will return nullptr if not found
+		[[nodiscard]] Value* Find(auto&& key) { return const_cast<Value*>(std::as_const(*this).Find(key)); }
+
+		[[nodiscard]] const Value* Find(auto&& key) const
+		{
+			const auto found = m_map.Find(key);
+			if (found != m_map.End())
+				return &found->second;
+
+			if (IsRehashing())
+			{
+				const auto foundOld = m_oldMap.Find(key);
+				if (foundOld != m_oldMap.End())
+					return &foundOld->second;
+			}
+			return nullptr;
+		}
+
+		[[nodiscard]] bool Contains(auto&& key) const { return Find(key) != nullptr; }
+
+		Value& At(auto&& key)
+		{
+			Value* found = Find(key);
+			REX_CORE_ASSERT(found != nullptr, "Value not found ! use Find() instead");
+			return *found;
+		}
+
+		const Value& At(auto&& key) const
+		{
+			const Value* found = Find(key);
+			REX_CORE_ASSERT(found != nullptr, "Value not found ! use Find() instead");
+			return *found;
+		}
+
+		// Returns false if the key was already there, its value is left untouched
+		template<typename K, typename ...Args>
+		bool Insert(K&& key, Args&& ...args)
+		{
+			if (IsRehashing())
+			{
+				if (m_oldMap.Contains(key))
+					return false;
+				MoveOldItems();
+			}
+
+			if (m_map.Size() >= m_map.Capacity() && !m_map.Contains(key))
+				StartRehash();
+
+			return m_map.Insert(std::forward<K>(key), std::forward<Args>(args)...).second;
+		}
+
+		template<typename ...Args>
+		void InsertOrAssign(const Key& key, Args&& ...args)
+		{
+			if (IsRehashing())
+			{
+				const auto found = m_oldMap.Find(key);
+				if (found != m_oldMap.End())
+				{
+					found->second = Value(std::forward<Args>(args)...);
+					return;
+				}
+				MoveOldItems();
+			}
+
+			if (m_map.Size() >= m_map.Capacity() && !m_map.Contains(key))
+				StartRehash();
+
+			m_map.InsertOrAssign(key, std::forward<Args>(args)...);
+		}
+
+		bool Erase(const Key& key)
+		{
+			return m_map.Erase(key) || (IsRehashing() && m_oldMap.Erase(key));
+		}
+
+		// Reserving finishes any rehash in progress
+		void Reserve(U64 size)
+		{
+			FinishRehash();
+			m_map.Reserve(size);
+		}
+
+		void Clear()
+		{
+			m_map.Clear();
+			m_oldMap.Clear();
+		}
+
+		// Moves all the remaining items out of the old table
+		void FinishRehash()
+		{
+			REX_CORE_TRACE_FUNC();
+			if (!IsRehashing())
+				return;
+
+			while (IsRehashing())
+				MoveOldItem();
+			m_oldMap = MapType(m_map.GetAllocator()); // Release the old buckets and values
+		}
+
+		// Calls fn(const Key&, Value&) for each item, the map must not be modified during the iteration
+		template<typename Fn>
+		void ForEach(Fn&& fn)
+		{
+			for (auto& [key, value] : m_map)
+				fn(key, value);
+			for (auto& [key, value] : m_oldMap)
+				fn(key, value);
+		}
+
+		// Calls fn(const Key&, const Value&) for each item
+		template<typename Fn>
+		void ForEach(Fn&& fn) const
+		{
+			for (const auto& [key, value] : m_map)
+				fn(key, value);
+			for (const auto& [key, value] : m_oldMap)
+				fn(key, value);
+		}
+
+		AllocatorRef<Allocator> GetAllocator() const { return m_map.GetAllocator(); }
+
+	private:
+		// Items moved from the old table for each insert. The new table is twice as big as the old one, so with at least
+		// one item moved per insert the old table is always empty before the new one is full.
+		constexpr static U32 ItemsMovedPerInsert = 4;
+
+		void StartRehash()
+		{
+			REX_CORE_TRACE_FUNC();
+			FinishRehash(); // Only does something if the inserts outpaced the move, which the table sizes prevent
+
+			MapType newMap(m_map.GetAllocator());
+			newMap.Rehash(Math::Max<U64>(m_map.Size() * 2, 16)); // The values grow block by block, only the buckets need to be sized
+			m_oldMap = std::move(m_map);
+			m_map = std::move(newMap);
+		}
+
+		void MoveOldItems()
+		{
+			for (U32 i = 0; i < ItemsMovedPerInsert && IsRehashing(); i++)
+				MoveOldItem();
+
+			if (!IsRehashing())
+				m_oldMap = MapType(m_map.GetAllocator()); // Release the old buckets and values
+		}
+
+		void MoveOldItem()
+		{
+			// Taking the last item is the cheapest, nothing has to be moved in its place
+			auto item = m_oldMap.Extract(m_oldMap.Begin() + static_cast<std::ptrdiff_t>(m_oldMap.Size() - 1));
+			m_map.Insert(std::move(item.first), std::move(item.second));
+		}
+
+	private:
+		MapType m_map;
+		MapType m_oldMap; // Items not moved yet, empty when not rehashing
+	};
+}
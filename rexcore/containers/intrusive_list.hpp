@@ -0,0 +1,358 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/iterators.hpp>
+
+#include <bit>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace RexCore
+{
+	// Member to add to the items of an IntrusiveList, an item can be in as many lists as it has hooks.
+	// Copying or moving an item doesn't copy its links, the new hook starts unlinked.
+	class IntrusiveListHook
+	{
+	public:
+		IntrusiveListHook() noexcept = default;
+		IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+		IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept { return *this; }
+
+		~IntrusiveListHook()
+		{
+			REX_CORE_ASSERT(!IsLinked(), "The item is destroyed while still in an IntrusiveList, remove it first");
+		}
+
+		[[nodiscard]] bool IsLinked() const { return m_next != nullptr; }
+
+	private:
+		template<typename T, IntrusiveListHook T::* Hook>
+		friend class IntrusiveList;
+
+		IntrusiveListHook* m_prev = nullptr;
+		IntrusiveListHook* m_next = nullptr;
+#ifndef NDEBUG
+		const void* m_owner = nullptr; // List the hook is in, checked by the asserts of the list (enabled like REX_CORE_ASSERT)
+#endif
+	};
+
+	// Doubly linked list threaded through a hook member of its items : inserting and removing never allocates, an item
+	// is removed in O(1) from any of its lists given only a reference to it, and whole lists are spliced in O(1).
+	// The list doesn't own the items, they must be removed before being destroyed (asserted by the hook) and the list
+	// unlinks the remaining ones when it is destroyed.
+	//     struct Connection { IntrusiveListHook lruHook; IntrusiveListHook waitHook; ... };
+	//     IntrusiveList<Connection, &Connection::lruHook> lru;
+	template<typename T, IntrusiveListHook T::* Hook>
+	class IntrusiveList
+	{
+	public:
+		template<typename ValT>
+		class IteratorBase
+		{
+		public:
+			using RefType = std::add_lvalue_reference_t<ValT>;
+			using PtrType = std::add_pointer_t<ValT>;
+
+			// For std
+			using difference_type = ptrdiff_t;
+			using value_type = ValT;
+
+			IteratorBase() noexcept = default;
+
+			explicit IteratorBase(const IntrusiveListHook* node) noexcept
+				: m_node(const_cast<IntrusiveListHook*>(node))
+			{}
+
+			[[nodiscard]] friend bool operator==(const IteratorBase& lhs, const IteratorBase& rhs)
+			{
+				return lhs.m_node == rhs.m_node;
+			}
+			[[nodiscard]] friend bool operator!=(const IteratorBase& lhs, const IteratorBase& rhs)
+			{
+				return !(lhs == rhs);
+			}
+
+			IteratorBase& operator++()
+			{
+				m_node = m_node->m_next;
+				return *this;
+			}
+			IteratorBase operator++(int)
+			{
+				IteratorBase copy(*this);
+				++*this;
+				return copy;
+			}
+
+			IteratorBase& operator--()
+			{
+				m_node = m_node->m_prev;
+				return *this;
+			}
+			IteratorBase operator--(int)
+			{
+				IteratorBase copy(*this);
+				--*this;
+				return copy;
+			}
+
+			[[nodiscard]] RefType operator*() const
+			{
+				return *ItemFromHook(m_node);
+			}
+			[[nodiscard]] PtrType operator->() const
+			{
+				return ItemFromHook(m_node);
+			}
+
+			[[nodiscard]] operator IteratorBase<const ValT>() const
+			{
+				return IteratorBase<const ValT>(m_node);
+			}
+
+		private:
+			friend class IntrusiveList;
+
+			IntrusiveListHook* m_node = nullptr;
+		};
+
+		using Iterator = IteratorBase<T>;
+		using ConstIterator = IteratorBase<const T>;
+		static_assert(std::bidirectional_iterator<Iterator>);
+		static_assert(std::bidirectional_iterator<ConstIterator>);
+
+	public:
+		REX_CORE_NO_COPY(IntrusiveList);
+
+		IntrusiveList() noexcept
+		{
+			m_sentinel.m_prev = &m_sentinel;
+			m_sentinel.m_next = &m_sentinel;
+		}
+
+		IntrusiveList(IntrusiveList&& other) noexcept
+			: IntrusiveList()
+		{
+			Splice(End(), other);
+		}
+
+		IntrusiveList& operator=(IntrusiveList&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			Clear();
+			Splice(End(), other);
+			return *this;
+		}
+
+		~IntrusiveList()
+		{
+			Clear();
+			m_sentinel.m_prev = nullptr;
+			m_sentinel.m_next = nullptr;
+		}
+
+		[[nodiscard]] U64 Size() const { return m_size; }
+		[[nodiscard]] bool IsEmpty() const { return m_size == 0; }
+
+		[[nodiscard]] T& Front()
+		{
+			REX_CORE_ASSERT(!IsEmpty());
+			return *ItemFromHook(m_sentinel.m_next);
+		}
+
+		[[nodiscard]] const T& Front() const
+		{
+			REX_CORE_ASSERT(!IsEmpty());
+			return *ItemFromHook(m_sentinel.m_next);
+		}
+
+		[[nodiscard]] T& Back()
+		{
+			REX_CORE_ASSERT(!IsEmpty());
+			return *ItemFromHook(m_sentinel.m_prev);
+		}
+
+		[[nodiscard]] const T& Back() const
+		{
+			REX_CORE_ASSERT(!IsEmpty());
+			return *ItemFromHook(m_sentinel.m_prev);
+		}
+
+		void PushFront(T& item) { InsertBefore(Begin(), item); }
+		void PushBack(T& item) { InsertBefore(End(), item); }
+
+		// Inserts item before position and returns its iterator
+		Iterator InsertBefore(ConstIterator position, T& item)
+		{
+			IntrusiveListHook& hook = item.*Hook;
+			REX_CORE_ASSERT(!hook.IsLinked(), "The item is already in a list, remove it first");
+			IntrusiveListHook* next = position.m_node;
+			hook.m_prev = next->m_prev;
+			hook.m_next = next;
+			next->m_prev->m_next = &hook;
+			next->m_prev = &hook;
+			SetOwner(hook, this);
+			m_size++;
+			return Iterator(&hook);
+		}
+
+		T& PopFront()
+		{
+			T& item = Front();
+			Remove(item);
+			return item;
+		}
+
+		T& PopBack()
+		{
+			T& item = Back();
+			Remove(item);
+			return item;
+		}
+
+		// The item must be in this list
+		void Remove(T& item)
+		{
+			IntrusiveListHook& hook = item.*Hook;
+			AssertOwned(hook);
+			hook.m_prev->m_next = hook.m_next;
+			hook.m_next->m_prev = hook.m_prev;
+			hook.m_prev = nullptr;
+			hook.m_next = nullptr;
+			SetOwner(hook, nullptr);
+			m_size--;
+		}
+
+		// Removes the item at position and returns the iterator of the next one
+		Iterator Remove(ConstIterator position)
+		{
+			REX_CORE_ASSERT(position != End(), "Can't remove End()");
+			Iterator next(position.m_node->m_next);
+			Remove(*ItemFromHook(position.m_node));
+			return next;
+		}
+
+		// Moves an item of this list, for instance the last used one of a LRU list
+		void MoveToFront(T& item) { MoveBefore(Begin(), item); }
+		void MoveToBack(T& item) { MoveBefore(End(), item); }
+
+		void MoveBefore(ConstIterator position, T& item)
+		{
+			AssertOwned(item.*Hook);
+			if (&(item.*Hook) == position.m_node)
+				return;
+			Remove(item);
+			InsertBefore(position, item);
+		}
+
+		// Moves all the items of other before position in O(1) (O(n) when the asserts are enabled), other is left empty
+		void Splice(ConstIterator position, IntrusiveList& other)
+		{
+			if (other.IsEmpty() || &other == this)
+				return;
+
+#ifndef NDEBUG
+			for (IntrusiveListHook* node = other.m_sentinel.m_next; node != &other.m_sentinel; node = node->m_next)
+				SetOwner(*node, this);
+#endif
+
+			IntrusiveListHook* next = position.m_node;
+			IntrusiveListHook* first = other.m_sentinel.m_next;
+			IntrusiveListHook* last = other.m_sentinel.m_prev;
+			first->m_prev = next->m_prev;
+			last->m_next = next;
+			next->m_prev->m_next = first;
+			next->m_prev = last;
+			m_size += other.m_size;
+
+			other.m_sentinel.m_prev = &other.m_sentinel;
+			other.m_sentinel.m_next = &other.m_sentinel;
+			other.m_size = 0;
+		}
+
+		// Moves one item of other before position
+		void Splice(ConstIterator position, IntrusiveList& other, T& item)
+		{
+			other.AssertOwned(item.*Hook);
+			other.Remove(item);
+			InsertBefore(position, item);
+		}
+
+		// Unlinks all the items in O(n)
+		void Clear()
+		{
+			IntrusiveListHook* node = m_sentinel.m_next;
+			while (node != &m_sentinel)
+			{
+				IntrusiveListHook* next = node->m_next;
+				node->m_prev = nullptr;
+				node->m_next = nullptr;
+				SetOwner(*node, nullptr);
+				node = next;
+			}
+			m_sentinel.m_prev = &m_sentinel;
+			m_sentinel.m_next = &m_sentinel;
+			m_size = 0;
+		}
+
+		// Iterator of an item of this list
+		[[nodiscard]] Iterator IteratorTo(T& item) const
+		{
+			AssertOwned(item.*Hook);
+			return Iterator(&(item.*Hook));
+		}
+
+		[[nodiscard]] Iterator Begin() { return Iterator(m_sentinel.m_next); }
+		[[nodiscard]] Iterator End() { return Iterator(&m_sentinel); }
+		[[nodiscard]] ConstIterator Begin() const { return ConstIterator(m_sentinel.m_next); }
+		[[nodiscard]] ConstIterator End() const { return ConstIterator(&m_sentinel); }
+
+		[[nodiscard]] operator Iter::ContainerView<ConstIterator>() const { return { Begin(), End() }; }
+		[[nodiscard]] operator Iter::ContainerView<Iterator>() { return { Begin(), End() }; }
+
+	public:
+		[[nodiscard]] Iterator begin() { return Begin(); }
+		[[nodiscard]] Iterator end() { return End(); }
+		[[nodiscard]] ConstIterator begin() const { return Begin(); }
+		[[nodiscard]] ConstIterator end() const { return End(); }
+
+	private:
+		void AssertOwned([[maybe_unused]] const IntrusiveListHook& hook) const
+		{
+			REX_CORE_ASSERT(hook.IsLinked(), "The item is not in a list");
+#ifndef NDEBUG
+			REX_CORE_ASSERT(hook.m_owner == this, "The item is not in this list");
+#endif
+		}
+
+		static void SetOwner([[maybe_unused]] IntrusiveListHook& hook, [[maybe_unused]] const IntrusiveList* owner)
+		{
+#ifndef NDEBUG
+			hook.m_owner = owner;
+#endif
+		}
+
+		// Offset of the hook in T. A data member pointer holds the offset of the member with MSVC, GCC and Clang (as used by
+		// boost::intrusive), so no object is needed to compute it.
+		[[nodiscard]] static U64 HookOffset()
+		{
+			using HookPointer = IntrusiveListHook T::*;
+			static_assert(sizeof(HookPointer) == sizeof(S32) || sizeof(HookPointer) == sizeof(S64), "Unsupported member pointer, T can't use virtual inheritance");
+			if constexpr (sizeof(HookPointer) == sizeof(S32))
+				return static_cast<U64>(std::bit_cast<S32>(Hook));
+			else
+				return static_cast<U64>(std::bit_cast<S64>(Hook));
+		}
+
+		[[nodiscard]] static T* ItemFromHook(const IntrusiveListHook* hook)
+		{
+			return reinterpret_cast<T*>(const_cast<Byte*>(reinterpret_cast<const Byte*>(hook) - HookOffset()));
+		}
+
+	private:
+		IntrusiveListHook m_sentinel;
+		U64 m_size = 0;
+	};
+}
@@ -0,0 +1,368 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/concepts.hpp>
+#include <rexcore/containers/map.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/concurrent_map.hpp>
+
+#include <rexcore/vendors/unordered_dense.hpp>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace RexCore
+{
+	enum class CachePolicy
+	{
+		Lru,   // Evicts the least recently used entry, every hit moves the entry to the front of a list
+		Clock, // Approximation of Lru, a hit only sets a bit and the eviction sweeps the entries clearing the bits
+	};
+
+	struct CacheStats
+	{
+		U64 hits = 0;
+		U64 misses = 0;
+	};
+
+	// Bounded cache, Put() evicts an entry when the cache is full. The entries are stored in a single array allocated
+	// once for the whole capacity and linked with indices, the HashMap maps the keys to their index in the array.
+	// Keys must be IClonable, the HashMap holds a clone of each key.
+	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>, CachePolicy Policy = CachePolicy::Lru>
+	class LruCache
+	{
+	public:
+		REX_CORE_NO_COPY(LruCache);
+		REX_CORE_DEFAULT_MOVE(LruCache);
+
+		explicit LruCache(U32 capacity, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_nodes(allocator), m_indices(allocator), m_capacity(capacity)
+		{
+			REX_CORE_ASSERT(capacity > 0 && capacity < InvalidIndex);
+			m_nodes.Reserve(capacity);
+			m_indices.Reserve(capacity);
+		}
+
+		[[nodiscard]] U32 Size() const { return m_nodes.Size(); }
+		[[nodiscard]] U32 Capacity() const { return m_capacity; }
+		[[nodiscard]] bool IsEmpty() const { return m_nodes.IsEmpty(); }
+
+		[[nodiscard]] CacheStats GetStats() const { return m_stats; }
+		void ResetStats() { m_stats = CacheStats{}; }
+
+		// Returns nullptr on a miss, counts in the stats and marks the entry as used
+		[[nodiscard]] Value* Get(const auto& key)
+		{
+			const auto found = m_indices.Find(key);
+			if (found == m_indices.End())
+			{
+				m_stats.misses++;
+				return nullptr;
+			}
+
+			m_stats.hits++;
+			Touch(found->second);
+			return &m_nodes[found->second].value;
+		}
+
+		// Doesn't count in the stats nor mark the entry as used
+		[[nodiscard]] const Value* Peek(const auto& key) const
+		{
+			const auto found = m_indices.Find(key);
+			return found == m_indices.End() ? nullptr : &m_nodes[found->second].value;
+		}
+
+		[[nodiscard]] bool Contains(const auto& key) const { return m_indices.Contains(key); }
+
+		// Inserts or replaces the value of key, evicts an entry if the cache is full
+		template<typename K, typename ...Args>
+		Value& Put(K&& key, Args&& ...args)
+		{
+			const auto found = m_indices.Find(key);
+			if (found != m_indices.End())
+			{
+				const U32 index = found->second;
+				m_nodes[index].value = Value(std::forward<Args>(args)...);
+				Touch(index);
+				return m_nodes[index].value;
+			}
+
+			U32 index;
+			if (m_nodes.Size() < m_capacity)
+			{
+				index = m_nodes.Size();
+				m_nodes.EmplaceBack(std::forward<K>(key), std::forward<Args>(args)...);
+				if constexpr (Policy == CachePolicy::Lru)
+					PushFront(index);
+			}
+			else
+			{
+				// The new entry takes the place of the evicted one in the array
+				index = FindVictim();
+				Node& node = m_nodes[index];
+				m_indices.Erase(node.key);
+				const U32 prev = node.prev;
+				const U32 next = node.next;
+				std::destroy_at(&node);
+				std::construct_at(&node, std::forward<K>(key), std::forward<Args>(args)...);
+				node.prev = prev;
+				node.next = next;
+				if constexpr (Policy == CachePolicy::Lru)
+					MoveToFront(index);
+			}
+
+			m_indices.Insert(RexCore::Clone(m_nodes[index].key), index);
+			return m_nodes[index].value;
+		}
+
+		bool Erase(const Key& key)
+		{
+			const auto found = m_indices.Find(key);
+			if (found == m_indices.End())
+				return false;
+
+			const U32 index = found->second;
+			m_indices.Erase(key);
+			if constexpr (Policy == CachePolicy::Lru)
+				Unlink(index);
+
+			// Keep the array dense, the last entry is moved in the hole
+			const bool movesLast = index != m_nodes.Size() - 1;
+			m_nodes.RemoveAt(index);
+			if (movesLast)
+			{
+				const Node& node = m_nodes[index];
+				m_indices.Find(node.key)->second = index;
+
+				if constexpr (Policy == CachePolicy::Lru)
+				{
+					if (node.prev != InvalidIndex)
+						m_nodes[node.prev].next = index;
+					else
+						m_head = index;
+
+					if (node.next != InvalidIndex)
+						m_nodes[node.next].prev = index;
+					else
+						m_tail = index;
+				}
+			}
+
+			if (m_hand >= m_nodes.Size())
+				m_hand = 0;
+			return true;
+		}
+
+		void Clear()
+		{
+			m_nodes.Clear();
+			m_indices.Clear();
+			m_head = InvalidIndex;
+			m_tail = InvalidIndex;
+			m_hand = 0;
+		}
+
+	private:
+		constexpr static U32 InvalidIndex = Math::MaxValue<U32>();
+
+		struct Node
+		{
+			template<typename K, typename ...Args>
+			Node(K&& key, Args&& ...args)
+				: key(std::forward<K>(key)), value(std::forward<Args>(args)...)
+			{}
+
+			Key key;
+			Value value;
+			U32 prev = InvalidIndex; // Towards the most recently used, Lru only
+			U32 next = InvalidIndex;
+			bool referenced = false; // Clock only
+		};
+
+		void Touch(U32 index)
+		{
+			if constexpr (Policy == CachePolicy::Lru)
+				MoveToFront(index);
+			else
+				m_nodes[index].referenced = true;
+		}
+
+		[[nodiscard]] U32 FindVictim()
+		{
+			if constexpr (Policy == CachePolicy::Lru)
+			{
+				return m_tail;
+			}
+			else
+			{
+				// Gives a second chance to the referenced entries, terminates after at most one full sweep
+				while (m_nodes[m_hand].referenced)
+				{
+					m_nodes[m_hand].referenced = false;
+					m_hand = m_hand + 1 == m_nodes.Size() ? 0 : m_hand + 1;
+				}
+
+				const U32 victim = m_hand;
+				m_hand = m_hand + 1 == m_nodes.Size() ? 0 : m_hand + 1;
+				return victim;
+			}
+		}
+
+		void Unlink(U32 index)
+		{
+			Node& node = m_nodes[index];
+			if (node.prev != InvalidIndex)
+				m_nodes[node.prev].next = node.next;
+			else
+				m_head = node.next;
+
+			if (node.next != InvalidIndex)
+				m_nodes[node.next].prev = node.prev;
+			else
+				m_tail = node.prev;
+		}
+
+		void PushFront(U32 index)
+		{
+			Node& node = m_nodes[index];
+			node.prev = InvalidIndex;
+			node.next = m_head;
+			if (m_head != InvalidIndex)
+				m_nodes[m_head].prev = index;
+			else
+				m_tail = index;
+			m_head = index;
+		}
+
+		void MoveToFront(U32 index)
+		{
+			if (index == m_head)
+				return;
+
+			Unlink(index);
+			PushFront(index);
+		}
+
+	private:
+		Vector<Node, Allocator> m_nodes;
+		HashMap<Key, U32, Allocator, Hash> m_indices;
+		U32 m_capacity;
+		U32 m_head = InvalidIndex; // Most recently used
+		U32 m_tail = InvalidIndex; // Least recently used
+		U32 m_hand = 0; // Next entry checked by the Clock policy
+		CacheStats m_stats;
+	};
+
+	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>>
+	using ClockCache = LruCache<Key, Value, Allocator, Hash, CachePolicy::Clock>;
+
+	// Thread safe cache split in shards by hash, each shard is an LruCache with its own lock and an equal part of the capacity.
+	// Every Get() modifies the shard (recency and stats) so the shards use plain mutexes rather than reader-writer locks.
+	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>, CachePolicy Policy = CachePolicy::Lru, U32 NumShards = 16>
+	class ConcurrentLruCache
+	{
+	public:
+		using ShardCache = LruCache<Key, Value, Allocator, Hash, Policy>;
+
+		static_assert(std::has_single_bit(NumShards), "The number of shards must be a power of 2");
+
+		REX_CORE_NO_COPY(ConcurrentLruCache);
+		REX_CORE_NO_MOVE(ConcurrentLruCache);
+
+		explicit ConcurrentLruCache(U32 capacity, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+		{
+			REX_CORE_ASSERT(capacity >= NumShards, "Each shard needs room for at least one entry");
+			for (U32 i = 0; i < NumShards; i++)
+				m_shards.EmplaceBack(capacity / NumShards + (i < capacity % NumShards ? 1 : 0), allocator);
+		}
+
+		[[nodiscard]] U64 Size() const
+		{
+			U64 size = 0;
+			for (const Shard& shard : m_shards)
+			{
+				std::lock_guard lock(shard.mutex);
+				size += shard.cache.Size();
+			}
+			return size;
+		}
+
+		[[nodiscard]] CacheStats GetStats() const
+		{
+			CacheStats stats;
+			for (const Shard& shard : m_shards)
+			{
+				std::lock_guard lock(shard.mutex);
+				stats.hits += shard.cache.GetStats().hits;
+				stats.misses += shard.cache.GetStats().misses;
+			}
+			return stats;
+		}
+
+		// Returns a copy of the value, std::nullopt on a miss
+		[[nodiscard]] std::optional<Value> Get(const auto& key)
+		{
+			Shard& shard = GetShard(key);
+			std::lock_guard lock(shard.mutex);
+			const Value* value = shard.cache.Get(key);
+			if (value == nullptr)
+				return std::nullopt;
+			return *value;
+		}
+
+		[[nodiscard]] bool Contains(const auto& key) const
+		{
+			const Shard& shard = GetShard(key);
+			std::lock_guard lock(shard.mutex);
+			return shard.cache.Contains(key);
+		}
+
+		template<typename K, typename ...Args>
+		void Put(K&& key, Args&& ...args)
+		{
+			Shard& shard = GetShard(key);
+			std::lock_guard lock(shard.mutex);
+			shard.cache.Put(std::forward<K>(key), std::forward<Args>(args)...);
+		}
+
+		bool Erase(const Key& key)
+		{
+			Shard& shard = GetShard(key);
+			std::lock_guard lock(shard.mutex);
+			return shard.cache.Erase(key);
+		}
+
+		void Clear()
+		{
+			for (Shard& shard : m_shards)
+			{
+				std::lock_guard lock(shard.mutex);
+				shard.cache.Clear();
+			}
+		}
+
+	private:
+		struct alignas(64) Shard
+		{
+			REX_CORE_NO_COPY(Shard);
+			REX_CORE_NO_MOVE(Shard);
+
+			Shard(U32 capacity, AllocatorRef<Allocator> allocator)
+				: cache(capacity, allocator)
+			{}
+
+			mutable std::mutex mutex;
+			ShardCache cache;
+		};
+
+		template<typename K>
+		[[nodiscard]] Shard& GetShard(const K& key) { return m_shards[Internal::ShardIndex<Hash>(key, NumShards)]; }
+
+		template<typename K>
+		[[nodiscard]] const Shard& GetShard(const K& key) const { return m_shards[Internal::ShardIndex<Hash>(key, NumShards)]; }
+
+	private:
+		FixedVector<Shard, NumShards> m_shards;
+	};
+}
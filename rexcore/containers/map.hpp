@@ -2,17 +2,28 @@
 #include <rexcore/core.hpp>
 #include <rexcore/allocators.hpp>
 #include <rexcore/concepts.hpp>
+#include <rexcore/containers/span.hpp>
 #include <rexcore/containers/string.hpp>
+#include <rexcore/containers/hash_batch.hpp>
 
 #include <rexcore/vendors/unordered_dense.hpp>
 
 namespace RexCore
 {
-	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>>
-	class HashMap : ankerl::unordered_dense::map<Key, Value, Hash, std::equal_to<>, StdAllocatorAdaptor<std::pair<Key,Value>, Allocator>>
+	namespace Internal
+	{
+		template<typename Key, typename Value, IAllocator Allocator, typename Hash, bool IsSegmented>
+		using HashMapImpl = std::conditional_t<IsSegmented,
+			ankerl::unordered_dense::segmented_map<Key, Value, Hash, std::equal_to<>, StdAllocatorAdaptor<std::pair<Key, Value>, Allocator>>,
+			ankerl::unordered_dense::map<Key, Value, Hash, std::equal_to<>, StdAllocatorAdaptor<std::pair<Key, Value>, Allocator>>>;
+	}
+
+	// IsSegmented stores the values in fixed-size blocks instead of a single array, growing never moves them
+	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>, bool IsSegmented = false>
+	class HashMap : Internal::HashMapImpl<Key, Value, Allocator, Hash, IsSegmented>
 	{
 	private:
-		using Impl = ankerl::unordered_dense::map<Key, Value, Hash, std::equal_to<>, StdAllocatorAdaptor<std::pair<Key, Value>, Allocator>>;
+		using Impl = Internal::HashMapImpl<Key, Value, Allocator, Hash, IsSegmented>;
 		using KeyEqual = std::equal_to<Key>;
 
 	public:
@@ -58,6 +69,36 @@ namespace RexCore
 
 		void Reserve(U64 size) { Impl::reserve(size); }
 
+		// Only resizes the buckets for size items, unlike Reserve() the values are not reserved
+		void Rehash(U64 size) { Impl::rehash(size); }
+
+		// Number of items the map can hold before the next insert rehashes all of its buckets
+		[[nodiscard]] U64 Capacity() const
+		{
+			if (Impl::bucket_count() == Impl::max_bucket_count())
+				return Impl::bucket_count();
+			return static_cast<U64>(static_cast<float>(Impl::bucket_count()) * Impl::max_load_factor());
+		}
+
+		// out[i] is set to the iterator of keys[i], or End() if not found. The keys are processed in groups, the hashes
+		// of a group are computed and its buckets and values prefetched before resolving them, so the cache misses of
+		// big maps overlap instead of being paid one after the other.
+		void FindBatch(Span<Key> keys, Iterator* out)
+		{
+			Internal::HashFindBatch(static_cast<Impl&>(*this), keys, out);
+		}
+
+		void FindBatch(Span<Key> keys, ConstIterator* out) const
+		{
+			Internal::HashFindBatch(static_cast<const Impl&>(*this), keys, out);
+		}
+
+		// out[i] is set to Contains(keys[i]), see FindBatch()
+		void ContainsBatch(Span<Key> keys, bool* out) const
+		{
+			Internal::HashFindBatch(static_cast<const Impl&>(*this), keys, out);
+		}
+
 		template<typename K, typename ...Args>
 		decltype(auto) Insert(K&& key, Args&& ...args) { return Impl::try_emplace(std::forward<K&&>(key), std::forward<Args>(args)...); }
 
@@ -67,7 +108,11 @@ namespace RexCore
 			Impl::insert_or_assign(key, std::forward<Args>(args)...);
 		}
 
-		bool Erase(const Key& key) { return Impl::erase(key) == 1; }
+		// Erases with another type than Key (StringView in a map of String) without converting it when Hash is transparent
+		bool Erase(auto&& key) { return Impl::erase(std::forward<decltype(key)>(key)) == 1; }
+
+		// Removes the item and returns it, the last item is moved in its place
+		[[nodiscard]] std::pair<Key, Value> Extract(ConstIterator it) { return Impl::extract(it); }
 
 		void Clear() { Impl::clear(); }
 
@@ -107,6 +152,10 @@ namespace RexCore
 		{}
 	};
 
+	// Growing never moves the values, only the buckets are rehashed, see IncrementalHashMap to spread that as well
+	template<typename Key, typename Value, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>>
+	using SegmentedHashMap = HashMap<Key, Value, Allocator, Hash, true>;
+
 	template<typename Value, IAllocator Allocator = DefaultAllocator>
 	using StringHashMap = HashMap<String<>, Value, Allocator, HeterogenousStringHash>;
 }
\ No newline at end of file
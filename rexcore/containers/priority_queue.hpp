@@ -0,0 +1,365 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/span.hpp>
+#include <rexcore/containers/slot_map.hpp>
+
+#include <functional>
+#include <utility>
+
+namespace RexCore
+{
+	namespace Internal
+	{
+		// d-ary heap helpers, the children of i are Arity * i + 1 to Arity * i + Arity. The item is moved in a hole instead
+		// of being swapped at each level, onMove(index) is called each time an item lands at index.
+		template<U32 Arity, typename T, typename Less, typename OnMove>
+		void HeapSiftUp(T* data, U32 index, const Less& less, OnMove&& onMove)
+		{
+			T item = std::move(data[index]);
+			while (index > 0)
+			{
+				const U32 parent = (index - 1) / Arity;
+				if (!less(data[parent], item))
+					break;
+
+				data[index] = std::move(data[parent]);
+				onMove(index);
+				index = parent;
+			}
+			data[index] = std::move(item);
+			onMove(index);
+		}
+
+		template<U32 Arity, typename T, typename Less, typename OnMove>
+		void HeapSiftDown(T* data, U32 size, U32 index, const Less& less, OnMove&& onMove)
+		{
+			T item = std::move(data[index]);
+			while (true)
+			{
+				const U32 firstChild = index * Arity + 1;
+				if (firstChild >= size)
+					break;
+
+				// The children are contiguous, with Arity = 4 and small items they share a cache line
+				U32 best = firstChild;
+				const U32 lastChild = Math::Min(firstChild + Arity, size);
+				for (U32 child = firstChild + 1; child < lastChild; child++)
+				{
+					if (less(data[best], data[child]))
+						best = child;
+				}
+
+				if (!less(item, data[best]))
+					break;
+
+				data[index] = std::move(data[best]);
+				onMove(index);
+				index = best;
+			}
+			data[index] = std::move(item);
+			onMove(index);
+		}
+
+		// O(size) bottom up construction
+		template<U32 Arity, typename T, typename Less, typename OnMove>
+		void Heapify(T* data, U32 size, const Less& less, OnMove&& onMove)
+		{
+			if (size < 2)
+				return;
+
+			for (U32 index = (size - 2) / Arity + 1; index-- > 0;)
+				HeapSiftDown<Arity>(data, size, index, less, onMove);
+		}
+
+		struct HeapNoMove
+		{
+			void operator()(U32) const {}
+		};
+	}
+
+	// Heap on a Vector where Top() is the highest item according to Compare, std::less<> gives a max heap like
+	// std::priority_queue and std::greater<> a min heap. Each node has Arity children, 4 by default : the tree is half as
+	// deep as a binary heap and the children compared when popping are next to each other in memory.
+	template<typename T, IAllocator Allocator = DefaultAllocator, typename Compare = std::less<>, U32 Arity = 4>
+	class PriorityQueue
+	{
+	public:
+		static_assert(Arity >= 2, "A heap node needs at least 2 children");
+
+		REX_CORE_NO_COPY(PriorityQueue);
+		REX_CORE_DEFAULT_MOVE(PriorityQueue);
+
+		explicit PriorityQueue(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_items(allocator)
+		{}
+
+		// Takes the items in any order and heapifies them in O(n)
+		explicit PriorityQueue(Vector<T, Allocator>&& items)
+			: m_items(std::move(items))
+		{
+			Internal::Heapify<Arity>(m_items.Data(), m_items.Size(), Compare{}, Internal::HeapNoMove{});
+		}
+
+		[[nodiscard]] PriorityQueue Clone() const
+		{
+			PriorityQueue clone(m_items.GetAllocator());
+			clone.m_items = m_items.Clone();
+			return clone;
+		}
+
+		[[nodiscard]] U32 Size() const { return m_items.Size(); }
+		[[nodiscard]] bool IsEmpty() const { return m_items.IsEmpty(); }
+		void Reserve(U32 size) { m_items.Reserve(size); }
+		void Clear() { m_items.Clear(); }
+
+		[[nodiscard]] const T& Top() const
+		{
+			REX_CORE_ASSERT(!IsEmpty());
+			return m_items[0];
+		}
+
+		void Push(const T& value) { Emplace(value); }
+		void Push(T&& value) { Emplace(std::move(value)); }
+
+		template<typename ...Args>
+		void Emplace(Args&& ...args)
+		{
+			m_items.EmplaceBack(std::forward<Args>(args)...);
+			Internal::HeapSiftUp<Arity>(m_items.Data(), m_items.Size() - 1, Compare{}, Internal::HeapNoMove{});
+		}
+
+		// Pushes many items at once, the heap is rebuilt in O(n) when that is cheaper than sifting each of them up
+		void PushN(Span<T> values)
+		{
+			REX_CORE_TRACE_FUNC();
+			const U32 oldSize = m_items.Size();
+			m_items.Reserve(oldSize + values.Size());
+			for (const T& value : values)
+				m_items.EmplaceBack(RexCore::Clone(value));
+
+			if (values.Size() > oldSize / 8)
+			{
+				Internal::Heapify<Arity>(m_items.Data(), m_items.Size(), Compare{}, Internal::HeapNoMove{});
+			}
+			else
+			{
+				for (U32 i = oldSize; i < m_items.Size(); i++)
+					Internal::HeapSiftUp<Arity>(m_items.Data(), i, Compare{}, Internal::HeapNoMove{});
+			}
+		}
+
+		// Removes and returns Top()
+		T Pop()
+		{
+			REX_CORE_ASSERT(!IsEmpty());
+			if (m_items.Size() == 1)
+				return m_items.PopBack();
+
+			T top = std::move(m_items[0]);
+			m_items[0] = m_items.PopBack();
+			Internal::HeapSiftDown<Arity>(m_items.Data(), m_items.Size(), 0, Compare{}, Internal::HeapNoMove{});
+			return top;
+		}
+
+		// Items in heap order, only the first one is in its final place
+		[[nodiscard]] Span<T> GetValues() const { return m_items; }
+
+		// Gives the items back in heap order and leaves the queue empty
+		[[nodiscard]] Vector<T, Allocator> Release() { return std::move(m_items); }
+
+		[[nodiscard]] AllocatorRef<Allocator> GetAllocator() const { return m_items.GetAllocator(); }
+
+	private:
+		Vector<T, Allocator> m_items;
+	};
+
+	// PriorityQueue where each pushed item gets a SlotHandle, so its priority can be changed or the item removed before it
+	// reaches the top (Dijkstra, timers of a scheduler). The handles follow the same rules as the SlotMap ones : once the
+	// item is popped or erased its handle is no longer Contains() even if the slot is reused.
+	template<typename T, IAllocator Allocator = DefaultAllocator, typename Compare = std::less<>, U32 Arity = 4>
+	class IndexedPriorityQueue
+	{
+	public:
+		static_assert(Arity >= 2, "A heap node needs at least 2 children");
+
+		REX_CORE_NO_COPY(IndexedPriorityQueue);
+		REX_CORE_DEFAULT_MOVE(IndexedPriorityQueue);
+
+		explicit IndexedPriorityQueue(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_heap(allocator), m_slots(allocator)
+		{}
+
+		[[nodiscard]] U32 Size() const { return m_heap.Size(); }
+		[[nodiscard]] bool IsEmpty() const { return m_heap.IsEmpty(); }
+
+		void Reserve(U32 size)
+		{
+			m_heap.Reserve(size);
+			m_slots.Reserve(size);
+		}
+
+		// Invalidates all the handles, the slots are kept for the next pushes
+		void Clear()
+		{
+			for (const Entry& entry : m_heap)
+				FreeSlot(entry.slot);
+			m_heap.Clear();
+		}
+
+		[[nodiscard]] const T& Top() const
+		{
+			REX_CORE_ASSERT(!IsEmpty());
+			return m_heap[0].value;
+		}
+
+		[[nodiscard]] SlotHandle TopHandle() const
+		{
+			REX_CORE_ASSERT(!IsEmpty());
+			const U32 slot = m_heap[0].slot;
+			return { slot, m_slots[slot].generation };
+		}
+
+		template<typename ...Args>
+		SlotHandle Push(Args&& ...args)
+		{
+			U32 slotIndex = m_freeHead;
+			if (slotIndex != InvalidIndex)
+			{
+				m_freeHead = m_slots[slotIndex].heapIndex;
+			}
+			else
+			{
+				slotIndex = m_slots.Size();
+				m_slots.EmplaceBack();
+			}
+
+			Slot& slot = m_slots[slotIndex];
+			slot.generation++; // Odd while the slot holds an item
+			m_heap.EmplaceBack(T(std::forward<Args>(args)...), slotIndex);
+			Internal::HeapSiftUp<Arity>(m_heap.Data(), m_heap.Size() - 1, EntryLess{}, UpdateSlot{ m_slots.Data(), m_heap.Data() });
+			return { slotIndex, slot.generation };
+		}
+
+		// Removes and returns Top()
+		T Pop()
+		{
+			REX_CORE_ASSERT(!IsEmpty());
+			return RemoveAt(0);
+		}
+
+		[[nodiscard]] bool Contains(SlotHandle handle) const
+		{
+			return handle.index < m_slots.Size() && m_slots[handle.index].generation == handle.generation && (handle.generation & 1) != 0;
+		}
+
+		[[nodiscard]] const T& Get(SlotHandle handle) const
+		{
+			REX_CORE_ASSERT(Contains(handle), "Item not found !");
+			return m_heap[m_slots[handle.index].heapIndex].value;
+		}
+
+		// The new value must not be lower than the current one according to Compare, so the item can only move toward the
+		// top. With std::greater<> (a min heap, as in Dijkstra) that is a lower value, hence the name.
+		void DecreaseKey(SlotHandle handle, T value)
+		{
+			REX_CORE_ASSERT(Contains(handle), "Item not found !");
+			const U32 index = m_slots[handle.index].heapIndex;
+			REX_CORE_ASSERT(!Compare{}(value, m_heap[index].value), "The new value would move the item away from the top, use Update()");
+			m_heap[index].value = std::move(value);
+			Internal::HeapSiftUp<Arity>(m_heap.Data(), index, EntryLess{}, UpdateSlot{ m_slots.Data(), m_heap.Data() });
+		}
+
+		// Changes the value in any direction
+		void Update(SlotHandle handle, T value)
+		{
+			REX_CORE_ASSERT(Contains(handle), "Item not found !");
+			const U32 index = m_slots[handle.index].heapIndex;
+			m_heap[index].value = std::move(value);
+			Restore(index);
+		}
+
+		// Returns false if the item was already popped or erased
+		bool Erase(SlotHandle handle)
+		{
+			if (!Contains(handle))
+				return false;
+
+			RemoveAt(m_slots[handle.index].heapIndex);
+			return true;
+		}
+
+		[[nodiscard]] AllocatorRef<Allocator> GetAllocator() const { return m_heap.GetAllocator(); }
+
+	private:
+		constexpr static U32 InvalidIndex = Math::MaxValue<U32>();
+
+		struct Entry
+		{
+			T value;
+			U32 slot;
+
+			Entry(T&& value, U32 slot)
+				: value(std::move(value)), slot(slot)
+			{}
+		};
+
+		struct Slot
+		{
+			U32 heapIndex = InvalidIndex; // Next free slot when the slot is free
+			U32 generation = 0;
+		};
+
+		struct EntryLess
+		{
+			[[nodiscard]] bool operator()(const Entry& lhs, const Entry& rhs) const { return Compare{}(lhs.value, rhs.value); }
+		};
+
+		struct UpdateSlot
+		{
+			Slot* slots;
+			const Entry* heap;
+
+			void operator()(U32 index) const { slots[heap[index].slot].heapIndex = index; }
+		};
+
+		void FreeSlot(U32 slotIndex)
+		{
+			Slot& slot = m_slots[slotIndex];
+			slot.generation++;
+			slot.heapIndex = m_freeHead;
+			m_freeHead = slotIndex;
+		}
+
+		// Sifts the item at index up or down to its place
+		void Restore(U32 index)
+		{
+			const UpdateSlot updateSlot{ m_slots.Data(), m_heap.Data() };
+			if (index > 0 && EntryLess{}(m_heap[(index - 1) / Arity], m_heap[index]))
+				Internal::HeapSiftUp<Arity>(m_heap.Data(), index, EntryLess{}, updateSlot);
+			else
+				Internal::HeapSiftDown<Arity>(m_heap.Data(), m_heap.Size(), index, EntryLess{}, updateSlot);
+		}
+
+		T RemoveAt(U32 index)
+		{
+			REX_CORE_TRACE_FUNC();
+			FreeSlot(m_heap[index].slot);
+			T value = std::move(m_heap[index].value);
+			Entry last = m_heap.PopBack();
+			if (index < m_heap.Size())
+			{
+				m_heap[index] = std::move(last);
+				Restore(index);
+			}
+			return value;
+		}
+
+	private:
+		Vector<Entry, Allocator> m_heap;
+		Vector<Slot, Allocator> m_slots;
+		U32 m_freeHead = InvalidIndex;
+	};
+}
@@ -2,16 +2,20 @@
 #include <rexcore/core.hpp>
 #include <rexcore/allocators.hpp>
 #include <rexcore/concepts.hpp>
+#include <rexcore/containers/span.hpp>
+#include <rexcore/containers/string.hpp>
+#include <rexcore/containers/hash_batch.hpp>
 
 #include <rexcore/vendors/unordered_dense.hpp>
 
 namespace RexCore
 {
-	template<typename Key, IAllocator Allocator = DefaultAllocator, typename Hash = std::hash<Key>>
-	class HashSet : ankerl::unordered_dense::set<Key, Hash, std::equal_to<Key>, StdAllocatorAdaptor<Key, Allocator>>
+	// Lookups with another type than Key (StringView in a set of String) don't convert the key when Hash is transparent
+	template<typename Key, IAllocator Allocator = DefaultAllocator, typename Hash = ankerl::unordered_dense::hash<Key>>
+	class HashSet : ankerl::unordered_dense::set<Key, Hash, std::equal_to<>, StdAllocatorAdaptor<Key, Allocator>>
 	{
 	private:
-		using Impl = ankerl::unordered_dense::set<Key, Hash, std::equal_to<Key>, StdAllocatorAdaptor<Key, Allocator>>;
+		using Impl = ankerl::unordered_dense::set<Key, Hash, std::equal_to<>, StdAllocatorAdaptor<Key, Allocator>>;
 
 	public:
 		using Iterator = typename Impl::iterator;
@@ -33,12 +37,31 @@ namespace RexCore
 		[[nodiscard]] U64 Size() const { return Impl::size(); }
 		[[nodiscard]] bool IsEmpty() const { return Size() == 0; }
 
-		[[nodiscard]] bool Contains(const Key& key)
+		[[nodiscard]] decltype(auto) Find(auto&& key) { return Impl::find(std::forward<decltype(key)>(key)); }
+		[[nodiscard]] decltype(auto) Find(auto&& key) const { return Impl::find(std::forward<decltype(key)>(key)); }
+
+		[[nodiscard]] bool Contains(auto&& key) const { return Impl::find(std::forward<decltype(key)>(key)) != Impl::end(); }
+
+		void Reserve(U64 size) { Impl::reserve(size); }
+
+		// out[i] is set to the iterator of keys[i], or End() if not found. The keys are processed in groups, the hashes
+		// of a group are computed and its buckets and values prefetched before resolving them, so the cache misses of
+		// big maps overlap instead of being paid one after the other.
+		void FindBatch(Span<Key> keys, Iterator* out)
 		{
-			return Impl::find(key) != Impl::end();
+			Internal::HashFindBatch(static_cast<Impl&>(*this), keys, out);
 		}
 
-		void Reserve(U64 size) { Impl::reserve(size); }
+		void FindBatch(Span<Key> keys, ConstIterator* out) const
+		{
+			Internal::HashFindBatch(static_cast<const Impl&>(*this), keys, out);
+		}
+
+		// out[i] is set to Contains(keys[i]), see FindBatch()
+		void ContainsBatch(Span<Key> keys, bool* out) const
+		{
+			Internal::HashFindBatch(static_cast<const Impl&>(*this), keys, out);
+		}
 
 		template<typename ...Args>
 		bool Insert(Args&& ...args)
@@ -46,7 +69,26 @@ namespace RexCore
 			return Impl::emplace(std::forward<Args>(args)...).second;
 		}
 
-		bool Erase(const Key& key) { return Impl::erase(key) == 1; }
+		// Clones each key, reserves once for all of them. Returns the number of keys that were not in the set
+		U64 InsertRange(Span<Key> keys)
+		{
+			REX_CORE_TRACE_FUNC();
+			Impl::reserve(Impl::size() + keys.Size());
+
+			U64 inserted = 0;
+			for (const Key& key : keys)
+			{
+				if (Impl::find(key) == Impl::end())
+				{
+					Impl::emplace(RexCore::Clone(key));
+					inserted++;
+				}
+			}
+			return inserted;
+		}
+
+		// Erases with another type than Key (StringView in a map of String) without converting it when Hash is transparent
+		bool Erase(auto&& key) { return Impl::erase(std::forward<decltype(key)>(key)) == 1; }
 
 		void Clear() { Impl::clear(); }
 
@@ -85,4 +127,7 @@ namespace RexCore
 			: Impl(impl)
 		{}
 	};
+
+	template<IAllocator Allocator = DefaultAllocator>
+	using StringHashSet = HashSet<String<>, Allocator, HeterogenousStringHash>;
 }
\ No newline at end of file
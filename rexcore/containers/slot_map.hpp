@@ -0,0 +1,191 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/iterators.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/span.hpp>
+
+namespace RexCore
+{
+	// Handle to an item of a SlotMap, the slot index and the generation of the slot when the item was inserted
+	struct SlotHandle
+	{
+		constexpr static U32 InvalidIndex = Math::MaxValue<U32>();
+
+		U32 index = InvalidIndex;
+		U32 generation = 0;
+
+		// Only tells if the handle was returned by Insert(), use SlotMap::Contains() to know if the item is still there
+		[[nodiscard]] constexpr bool IsValid() const { return index != InvalidIndex; }
+
+		[[nodiscard]] constexpr U64 ToU64() const { return (static_cast<U64>(generation) << 32llu) | index; }
+		[[nodiscard]] constexpr static SlotHandle FromU64(U64 value) { return { static_cast<U32>(value), static_cast<U32>(value >> 32llu) }; }
+
+		[[nodiscard]] friend constexpr bool operator==(const SlotHandle& lhs, const SlotHandle& rhs) = default;
+	};
+
+	// Dense storage with stable handles : the items are contiguous and can be iterated as a Span, erasing moves the last
+	// item in the hole, and handles go through a slot that follows the item. Each slot has a generation that changes
+	// when its item is erased so old handles are detected even after the slot is reused.
+	// Insert, Erase and lookups are O(1). The generation wraps after 2^31 reuses of the same slot.
+	template<typename T, IAllocator Allocator = DefaultAllocator>
+	class SlotMap
+	{
+	public:
+		using Iterator = T*;
+		using ConstIterator = const T*;
+
+		REX_CORE_NO_COPY(SlotMap);
+		REX_CORE_DEFAULT_MOVE(SlotMap);
+
+		explicit SlotMap(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_values(allocator), m_valueSlots(allocator), m_slots(allocator)
+		{}
+
+		[[nodiscard]] U32 Size() const { return m_values.Size(); }
+		[[nodiscard]] bool IsEmpty() const { return m_values.IsEmpty(); }
+
+		void Reserve(U32 size)
+		{
+			m_values.Reserve(size);
+			m_valueSlots.Reserve(size);
+			m_slots.Reserve(size);
+		}
+
+		template<typename ...Args>
+		SlotHandle Insert(Args&& ...args)
+		{
+			REX_CORE_TRACE_FUNC();
+			U32 slotIndex = m_freeHead;
+			if (slotIndex != InvalidIndex)
+			{
+				m_freeHead = m_slots[slotIndex].valueIndex;
+			}
+			else
+			{
+				slotIndex = m_slots.Size();
+				m_slots.EmplaceBack();
+			}
+
+			Slot& slot = m_slots[slotIndex];
+			slot.generation++; // Odd while the slot holds an item
+			slot.valueIndex = m_values.Size();
+			m_values.EmplaceBack(std::forward<Args>(args)...);
+			m_valueSlots.EmplaceBack(slotIndex);
+			return { slotIndex, slot.generation };
+		}
+
+		// Returns false if the item was already erased
+		bool Erase(SlotHandle handle)
+		{
+			REX_CORE_TRACE_FUNC();
+			if (!Contains(handle))
+				return false;
+
+			Slot& slot = m_slots[handle.index];
+			const U32 valueIndex = slot.valueIndex;
+			const U32 lastSlot = m_valueSlots.Last();
+			m_values.RemoveAt(valueIndex);
+			m_valueSlots.RemoveAt(valueIndex);
+			if (valueIndex < m_values.Size())
+				m_slots[lastSlot].valueIndex = valueIndex; // The last item was moved in the hole
+
+			slot.generation++;
+			slot.valueIndex = m_freeHead;
+			m_freeHead = handle.index;
+			return true;
+		}
+
+		[[nodiscard]] bool Contains(SlotHandle handle) const
+		{
+			return handle.index < m_slots.Size() && m_slots[handle.index].generation == handle.generation && (handle.generation & 1) != 0;
+		}
+
+		// Will return nullptr if the item was erased
+		[[nodiscard]] T* TryFind(SlotHandle handle)
+		{
+			return Contains(handle) ? &m_values[m_slots[handle.index].valueIndex] : nullptr;
+		}
+
+		[[nodiscard]] const T* TryFind(SlotHandle handle) const
+		{
+			return Contains(handle) ? &m_values[m_slots[handle.index].valueIndex] : nullptr;
+		}
+
+		T& At(SlotHandle handle)
+		{
+			REX_CORE_ASSERT(Contains(handle), "Item not found ! use TryFind() instead");
+			return m_values[m_slots[handle.index].valueIndex];
+		}
+
+		const T& At(SlotHandle handle) const
+		{
+			REX_CORE_ASSERT(Contains(handle), "Item not found ! use TryFind() instead");
+			return m_values[m_slots[handle.index].valueIndex];
+		}
+
+		// Position of the item in the dense storage, changes when other items are erased
+		[[nodiscard]] U32 IndexOf(SlotHandle handle) const
+		{
+			REX_CORE_ASSERT(Contains(handle));
+			return m_slots[handle.index].valueIndex;
+		}
+
+		// Handle of the item at index in the dense storage, for instance with Iter::Enumerate(slotMap)
+		[[nodiscard]] SlotHandle GetHandle(U32 index) const
+		{
+			const U32 slotIndex = m_valueSlots[index];
+			return { slotIndex, m_slots[slotIndex].generation };
+		}
+
+		// Invalidates all the handles, the slots are kept for the next inserts
+		void Clear()
+		{
+			for (const U32 slotIndex : m_valueSlots)
+			{
+				Slot& slot = m_slots[slotIndex];
+				slot.generation++;
+				slot.valueIndex = m_freeHead;
+				m_freeHead = slotIndex;
+			}
+			m_values.Clear();
+			m_valueSlots.Clear();
+		}
+
+		[[nodiscard]] Span<T> GetValues() const { return m_values; }
+		[[nodiscard]] T* Data() { return m_values.Data(); }
+		[[nodiscard]] const T* Data() const { return m_values.Data(); }
+
+		[[nodiscard]] Iterator Begin() { return m_values.Begin(); }
+		[[nodiscard]] Iterator End() { return m_values.End(); }
+		[[nodiscard]] ConstIterator Begin() const { return m_values.Begin(); }
+		[[nodiscard]] ConstIterator End() const { return m_values.End(); }
+
+		[[nodiscard]] operator Iter::ContainerView<ConstIterator>() const { return m_values; }
+		[[nodiscard]] operator Iter::ContainerView<Iterator>() { return m_values; }
+
+		[[nodiscard]] AllocatorRef<Allocator> GetAllocator() const { return m_values.GetAllocator(); }
+
+	public:
+		[[nodiscard]] Iterator begin() { return Begin(); }
+		[[nodiscard]] Iterator end() { return End(); }
+		[[nodiscard]] ConstIterator begin() const { return Begin(); }
+		[[nodiscard]] ConstIterator end() const { return End(); }
+
+	private:
+		constexpr static U32 InvalidIndex = Math::MaxValue<U32>();
+
+		struct Slot
+		{
+			U32 valueIndex = InvalidIndex; // Next free slot when the slot is free
+			U32 generation = 0;
+		};
+
+	private:
+		Vector<T, Allocator> m_values;
+		Vector<U32, Allocator> m_valueSlots; // Slot of each value
+		Vector<Slot, Allocator> m_slots;
+		U32 m_freeHead = InvalidIndex;
+	};
+}
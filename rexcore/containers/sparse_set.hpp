@@ -0,0 +1,249 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/iterators.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/span.hpp>
+
+#include <bit>
+#include <utility>
+
+namespace RexCore
+{
+	// Map from integer keys in [0, MaxKeys) to values, for ids that are dense enough to index an array.
+	// The values and their keys are packed in two Vectors for contiguous iteration, erasing moves the last item in the hole.
+	// The sparse array maps each key to its position in the packed arrays, it is reserved for MaxKeys entries
+	// (64MB of address space for 2^24 keys) and its pages are only committed once a key inside them is inserted.
+	// Contains, Insert, Erase and lookups are O(1) without hashing.
+	template<typename T, IAllocator Allocator = DefaultAllocator, U32 MaxKeys = (1u << 24u)>
+	class SparseSet
+	{
+	public:
+		using Iterator = T*;
+		using ConstIterator = const T*;
+
+		REX_CORE_NO_COPY(SparseSet);
+
+		explicit SparseSet(AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_keys(allocator), m_values(allocator), m_committedPages(allocator)
+		{}
+
+		SparseSet(SparseSet&& other) noexcept
+			: m_keys(std::move(other.m_keys)), m_values(std::move(other.m_values)), m_committedPages(std::move(other.m_committedPages)),
+			m_sparse(std::exchange(other.m_sparse, nullptr)), m_entriesPerPageShift(other.m_entriesPerPageShift)
+		{}
+
+		SparseSet& operator=(SparseSet&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			ReleaseSparse();
+			m_keys = std::move(other.m_keys);
+			m_values = std::move(other.m_values);
+			m_committedPages = std::move(other.m_committedPages);
+			m_sparse = std::exchange(other.m_sparse, nullptr);
+			m_entriesPerPageShift = other.m_entriesPerPageShift;
+			return *this;
+		}
+
+		~SparseSet()
+		{
+			ReleaseSparse();
+		}
+
+		[[nodiscard]] U32 Size() const { return m_values.Size(); }
+		[[nodiscard]] bool IsEmpty() const { return m_values.IsEmpty(); }
+
+		// Reserves the packed arrays, the sparse pages are still committed on demand
+		void Reserve(U32 size)
+		{
+			m_keys.Reserve(size);
+			m_values.Reserve(size);
+		}
+
+		[[nodiscard]] bool Contains(U32 key) const
+		{
+			return key < MaxKeys && IsPageCommitted(key >> m_entriesPerPageShift) && m_sparse[key] != 0;
+		}
+
+		// Returns false if the key was already there, its value is left untouched
+		template<typename ...Args>
+		bool Insert(U32 key, Args&& ...args)
+		{
+			REX_CORE_TRACE_FUNC();
+			REX_CORE_ASSERT(key < MaxKeys, "Key out of range");
+			CommitPageOf(key);
+			if (m_sparse[key] != 0)
+				return false;
+
+			m_keys.EmplaceBack(key);
+			m_values.EmplaceBack(std::forward<Args>(args)...);
+			m_sparse[key] = m_values.Size(); // Position + 1 so the zeroed pages mean empty
+			return true;
+		}
+
+		template<typename ...Args>
+		void InsertOrAssign(U32 key, Args&& ...args)
+		{
+			T* found = TryFind(key);
+			if (found != nullptr)
+				*found = T(std::forward<Args>(args)...);
+			else
+				Insert(key, std::forward<Args>(args)...);
+		}
+
+		bool Erase(U32 key)
+		{
+			REX_CORE_TRACE_FUNC();
+			if (!Contains(key))
+				return false;
+
+			const U32 index = m_sparse[key] - 1;
+			const U32 lastKey = m_keys.Last();
+			m_keys.RemoveAt(index);
+			m_values.RemoveAt(index);
+			if (lastKey != key)
+				m_sparse[lastKey] = index + 1; // The last item was moved in the hole
+			m_sparse[key] = 0;
+			return true;
+		}
+
+		// Will return nullptr if not found
+		[[nodiscard]] T* TryFind(U32 key) { return Contains(key) ? &m_values[m_sparse[key] - 1] : nullptr; }
+		[[nodiscard]] const T* TryFind(U32 key) const { return Contains(key) ? &m_values[m_sparse[key] - 1] : nullptr; }
+
+		T& At(U32 key)
+		{
+			REX_CORE_ASSERT(Contains(key), "Value not found ! use TryFind() instead");
+			return m_values[m_sparse[key] - 1];
+		}
+
+		const T& At(U32 key) const
+		{
+			REX_CORE_ASSERT(Contains(key), "Value not found ! use TryFind() instead");
+			return m_values[m_sparse[key] - 1];
+		}
+
+		// Keeps the committed pages for the next inserts
+		void Clear()
+		{
+			for (const U32 key : m_keys)
+				m_sparse[key] = 0;
+			m_keys.Clear();
+			m_values.Clear();
+		}
+
+		// GetKeys()[i] is the key of GetValues()[i]
+		[[nodiscard]] Span<U32> GetKeys() const { return m_keys; }
+		[[nodiscard]] Span<T> GetValues() const { return m_values; }
+		[[nodiscard]] T* Data() { return m_values.Data(); }
+		[[nodiscard]] const T* Data() const { return m_values.Data(); }
+
+		// Calls fn(U32 key, T& value) for each item in the packed order
+		template<typename Fn>
+		void ForEach(Fn&& fn)
+		{
+			for (U32 i = 0; i < m_values.Size(); i++)
+				fn(m_keys[i], m_values[i]);
+		}
+
+		template<typename Fn>
+		void ForEach(Fn&& fn) const
+		{
+			for (U32 i = 0; i < m_values.Size(); i++)
+				fn(m_keys[i], m_values[i]);
+		}
+
+		[[nodiscard]] Iterator Begin() { return m_values.Begin(); }
+		[[nodiscard]] Iterator End() { return m_values.End(); }
+		[[nodiscard]] ConstIterator Begin() const { return m_values.Begin(); }
+		[[nodiscard]] ConstIterator End() const { return m_values.End(); }
+
+		[[nodiscard]] operator Iter::ContainerView<ConstIterator>() const { return m_values; }
+		[[nodiscard]] operator Iter::ContainerView<Iterator>() { return m_values; }
+
+		[[nodiscard]] AllocatorRef<Allocator> GetAllocator() const { return m_values.GetAllocator(); }
+
+	public:
+		[[nodiscard]] Iterator begin() { return Begin(); }
+		[[nodiscard]] Iterator end() { return End(); }
+		[[nodiscard]] ConstIterator begin() const { return Begin(); }
+		[[nodiscard]] ConstIterator end() const { return End(); }
+
+	private:
+		[[nodiscard]] U32 NumSparsePages() const { return static_cast<U32>(Math::CeilDiv<U64>(MaxKeys * sizeof(U32), PageSize)); }
+
+		[[nodiscard]] bool IsPageCommitted(U32 page) const
+		{
+			return page / 64 < m_committedPages.Size() && (m_committedPages[page / 64] & (1llu << (page % 64))) != 0;
+		}
+
+		void CommitPageOf(U32 key)
+		{
+			if (m_sparse == nullptr)
+			{
+				// The address space is only reserved by the first insert so empty sets are free
+				m_sparse = static_cast<U32*>(ReservePages(NumSparsePages()));
+				m_entriesPerPageShift = static_cast<U32>(std::countr_zero(PageSize / sizeof(U32)));
+				m_committedPages.Resize(Math::CeilDiv<U32>(NumSparsePages(), 64));
+			}
+
+			const U32 page = key >> m_entriesPerPageShift;
+			if (!IsPageCommitted(page))
+			{
+				CommitPages(m_sparse + (static_cast<U64>(page) << m_entriesPerPageShift), 1); // Committed pages are zeroed
+				m_committedPages[page / 64] |= 1llu << (page % 64);
+			}
+		}
+
+		void ReleaseSparse()
+		{
+			if (m_sparse == nullptr)
+				return;
+
+			for (U32 page = 0; page < NumSparsePages(); page++)
+			{
+				if (IsPageCommitted(page))
+					DecommitPages(m_sparse + (static_cast<U64>(page) << m_entriesPerPageShift), 1);
+			}
+			ReleasePages(m_sparse, NumSparsePages());
+			m_sparse = nullptr;
+			m_committedPages.Clear();
+		}
+
+	private:
+		Vector<U32, Allocator> m_keys;
+		Vector<T, Allocator> m_values;
+		Vector<U64, Allocator> m_committedPages; // One bit per page of the sparse array
+		U32* m_sparse = nullptr; // Position + 1 of each key in the packed arrays, 0 if the key is not there
+		U32 m_entriesPerPageShift = 0;
+	};
+
+	// Calls fn(U32 key, T& value...) for each key present in all the sets, with the value of each set. Only the keys of
+	// the smallest set are visited and each of them is checked in the other sets in O(1).
+	// The sets must not be modified by fn.
+	template<typename Fn, typename ...Sets>
+	void ForEachIntersection(Fn&& fn, Sets& ...sets)
+	{
+		static_assert(sizeof...(Sets) >= 1, "ForEachIntersection needs at least one set");
+		REX_CORE_TRACE_FUNC();
+
+		Span<U32> smallest;
+		U32 smallestSize = Math::MaxValue<U32>();
+		([&] {
+			if (sets.Size() < smallestSize)
+			{
+				smallestSize = sets.Size();
+				smallest = sets.GetKeys();
+			}
+		}(), ...);
+
+		for (const U32 key : smallest)
+		{
+			if ((sets.Contains(key) && ...))
+				fn(key, sets.At(key)...);
+		}
+	}
+}
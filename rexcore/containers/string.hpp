@@ -4,11 +4,17 @@
 #include <rexcore/containers/span.hpp>
 #include <rexcore/allocators.hpp>
 #include <rexcore/iterators.hpp>
+#include <rexcore/simd.hpp>
 
 #include <rexcore/vendors/unordered_dense.hpp> // for ankerl::unordered_dense::hash
 
 #include <cstring>
 #include <compare>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <optional>
 #include <string_view>
 #include <ostream>
 
@@ -40,6 +46,433 @@ namespace RexCore
 		{
 			return Math::Max(Math::NextPowerOfTwo(currentSize), newSize);
 		}
+
+		// Heap allocated string layout, m_capacity is always the last 8 bytes of the string storage, see StringBase
+		template<typename CharT, U64 PaddingBytes>
+		struct BigStringLayout
+		{
+			CharT* m_data;
+			U64 m_size;
+			Byte m_padding[PaddingBytes];
+			U64 m_capacity;
+		};
+
+		template<typename CharT>
+		struct BigStringLayout<CharT, 0>
+		{
+			CharT* m_data;
+			U64 m_size;
+			U64 m_capacity;
+		};
+
+		// All the search functions return size if nothing is found
+		template<typename CharT>
+		constexpr U64 StringFindChar(const CharT* str, U64 size, U64 start, CharT ch)
+		{
+			U64 i = start;
+#ifdef REX_CORE_SSE2
+			if constexpr (sizeof(CharT) == 1)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					const __m128i pattern = _mm_set1_epi8(static_cast<char>(ch));
+					for (; i + 16 <= size; i += 16)
+					{
+						const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+						const U32 mask = static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)));
+						if (mask != 0)
+							return i + std::countr_zero(mask);
+					}
+				}
+			}
+#endif
+			for (; i < size; i++)
+			{
+				if (str[i] == ch)
+					return i;
+			}
+			return size;
+		}
+
+		template<typename CharT>
+		constexpr U64 StringRFindChar(const CharT* str, U64 size, CharT ch)
+		{
+			U64 end = size; // Positions [0, end) are left to search
+#ifdef REX_CORE_SSE2
+			if constexpr (sizeof(CharT) == 1)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					const __m128i pattern = _mm_set1_epi8(static_cast<char>(ch));
+					for (; end >= 16; end -= 16)
+					{
+						const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + end - 16));
+						const U32 mask = static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)));
+						if (mask != 0)
+							return end - 16 + (31 - std::countl_zero(mask));
+					}
+				}
+			}
+#endif
+			while (end > 0)
+			{
+				end--;
+				if (str[end] == ch)
+					return end;
+			}
+			return size;
+		}
+
+		// Compares the first and last chars of the needle before comparing the whole needle,
+		// the SIMD version tests 16 positions at once (http://0x80.pl/articles/simd-strfind.html)
+		template<typename CharT>
+		constexpr U64 StringFind(const CharT* str, U64 size, U64 start, const CharT* needle, U64 needleSize)
+		{
+			if (needleSize == 0)
+				return Math::Min(start, size);
+
+			if (needleSize > size || start > size - needleSize)
+				return size;
+
+			if (needleSize == 1)
+				return StringFindChar(str, size, start, needle[0]);
+
+			const CharT first = needle[0];
+			const CharT last = needle[needleSize - 1];
+			const U64 lastStart = size - needleSize;
+			U64 i = start;
+#ifdef REX_CORE_SSE2
+			if constexpr (sizeof(CharT) == 1)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					const __m128i firstPattern = _mm_set1_epi8(static_cast<char>(first));
+					const __m128i lastPattern = _mm_set1_epi8(static_cast<char>(last));
+					for (; i + 15 <= lastStart; i += 16)
+					{
+						const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+						const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i + needleSize - 1));
+						U32 mask = static_cast<U32>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, firstPattern), _mm_cmpeq_epi8(blockLast, lastPattern))));
+						while (mask != 0)
+						{
+							const U64 pos = i + std::countr_zero(mask);
+							if (StringCompare(str + pos + 1, needle + 1, needleSize - 2) == 0)
+								return pos;
+							mask &= mask - 1;
+						}
+					}
+				}
+			}
+#endif
+			for (; i <= lastStart; i++)
+			{
+				if (str[i] == first && str[i + needleSize - 1] == last && StringCompare(str + i + 1, needle + 1, needleSize - 2) == 0)
+					return i;
+			}
+			return size;
+		}
+
+		template<typename CharT>
+		constexpr U64 StringRFind(const CharT* str, U64 size, const CharT* needle, U64 needleSize)
+		{
+			if (needleSize == 0 || needleSize > size)
+				return size;
+
+			if (needleSize == 1)
+				return StringRFindChar(str, size, needle[0]);
+
+			const CharT first = needle[0];
+			const CharT last = needle[needleSize - 1];
+			U64 end = size - needleSize + 1; // Positions [0, end) are left to search
+#ifdef REX_CORE_SSE2
+			if constexpr (sizeof(CharT) == 1)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					const __m128i firstPattern = _mm_set1_epi8(static_cast<char>(first));
+					const __m128i lastPattern = _mm_set1_epi8(static_cast<char>(last));
+					for (; end >= 16; end -= 16)
+					{
+						const U64 blockStart = end - 16;
+						const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + blockStart));
+						const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + blockStart + needleSize - 1));
+						U32 mask = static_cast<U32>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, firstPattern), _mm_cmpeq_epi8(blockLast, lastPattern))));
+						while (mask != 0)
+						{
+							const U32 bit = 31 - std::countl_zero(mask);
+							if (StringCompare(str + blockStart + bit + 1, needle + 1, needleSize - 2) == 0)
+								return blockStart + bit;
+							mask &= ~(1u << bit);
+						}
+					}
+				}
+			}
+#endif
+			while (end > 0)
+			{
+				end--;
+				if (str[end] == first && str[end + needleSize - 1] == last && StringCompare(str + end + 1, needle + 1, needleSize - 2) == 0)
+					return end;
+			}
+			return size;
+		}
+
+		// 256 bits lookup table of the chars in a set, only for single byte chars
+		struct CharSetTable
+		{
+			U64 bits[4] = {};
+
+			constexpr CharSetTable(const char* set, U64 setSize)
+			{
+				for (U64 i = 0; i < setSize; i++)
+				{
+					const U8 c = static_cast<U8>(set[i]);
+					bits[c >> 6] |= 1llu << (c & 63);
+				}
+			}
+
+			[[nodiscard]] constexpr bool Contains(char ch) const
+			{
+				const U8 c = static_cast<U8>(ch);
+				return (bits[c >> 6] >> (c & 63)) & 1;
+			}
+		};
+
+		template<typename CharT>
+		constexpr bool CharSetContains(const CharT* set, U64 setSize, CharT ch)
+		{
+			for (U64 i = 0; i < setSize; i++)
+			{
+				if (set[i] == ch)
+					return true;
+			}
+			return false;
+		}
+
+#ifdef REX_CORE_SSE2
+		// Bitmask of the chars of block that are in the set, setSize must be <= MaxSimdCharSetSize
+		constexpr U64 MaxSimdCharSetSize = 8;
+		inline U32 CharSetMatchMask(__m128i block, const __m128i* setPatterns, U64 setSize)
+		{
+			__m128i matches = _mm_setzero_si128();
+			for (U64 j = 0; j < setSize; j++)
+				matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, setPatterns[j]));
+			return static_cast<U32>(_mm_movemask_epi8(matches));
+		}
+#endif
+
+		template<typename CharT>
+		constexpr U64 StringFindFirstOf(const CharT* str, U64 size, U64 start, const CharT* set, U64 setSize)
+		{
+			if (setSize == 1)
+				return StringFindChar(str, size, start, set[0]);
+
+			U64 i = start;
+			if constexpr (sizeof(CharT) == 1)
+			{
+#ifdef REX_CORE_SSE2
+				if (!std::is_constant_evaluated() && setSize <= MaxSimdCharSetSize)
+				{
+					__m128i setPatterns[MaxSimdCharSetSize];
+					for (U64 j = 0; j < setSize; j++)
+						setPatterns[j] = _mm_set1_epi8(static_cast<char>(set[j]));
+
+					for (; i + 16 <= size; i += 16)
+					{
+						const U32 mask = CharSetMatchMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i)), setPatterns, setSize);
+						if (mask != 0)
+							return i + std::countr_zero(mask);
+					}
+				}
+#endif
+				const CharSetTable table(set, setSize);
+				for (; i < size; i++)
+				{
+					if (table.Contains(str[i]))
+						return i;
+				}
+			}
+			else
+			{
+				for (; i < size; i++)
+				{
+					if (CharSetContains(set, setSize, str[i]))
+						return i;
+				}
+			}
+			return size;
+		}
+
+		template<typename CharT>
+		constexpr U64 StringFindLastOf(const CharT* str, U64 size, const CharT* set, U64 setSize)
+		{
+			if (setSize == 1)
+				return StringRFindChar(str, size, set[0]);
+
+			U64 end = size; // Positions [0, end) are left to search
+			if constexpr (sizeof(CharT) == 1)
+			{
+#ifdef REX_CORE_SSE2
+				if (!std::is_constant_evaluated() && setSize <= MaxSimdCharSetSize)
+				{
+					__m128i setPatterns[MaxSimdCharSetSize];
+					for (U64 j = 0; j < setSize; j++)
+						setPatterns[j] = _mm_set1_epi8(static_cast<char>(set[j]));
+
+					for (; end >= 16; end -= 16)
+					{
+						const U32 mask = CharSetMatchMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + end - 16)), setPatterns, setSize);
+						if (mask != 0)
+							return end - 16 + (31 - std::countl_zero(mask));
+					}
+				}
+#endif
+				const CharSetTable table(set, setSize);
+				while (end > 0)
+				{
+					end--;
+					if (table.Contains(str[end]))
+						return end;
+				}
+			}
+			else
+			{
+				while (end > 0)
+				{
+					end--;
+					if (CharSetContains(set, setSize, str[end]))
+						return end;
+				}
+			}
+			return size;
+		}
+	}
+
+	template<typename T>
+	struct ParseResult
+	{
+		T value;
+		U64 length; // Number of chars consumed
+	};
+
+	namespace Internal
+	{
+		// Loads 8 chars in a U64 with the first char in the lowest byte
+		[[nodiscard]] constexpr U64 LoadEightChars(const char* str)
+		{
+			if (std::is_constant_evaluated() || !IsLittleEndian())
+			{
+				U64 chunk = 0;
+				for (U64 i = 0; i < 8; i++)
+					chunk |= static_cast<U64>(static_cast<U8>(str[i])) << (i * 8llu);
+				return chunk;
+			}
+
+			U64 chunk;
+			std::memcpy(&chunk, str, sizeof(chunk));
+			return chunk;
+		}
+
+		// Highest bit of each byte set when the char is not in '0'..'9'
+		[[nodiscard]] constexpr U64 NonDigitMask(U64 chunk)
+		{
+			const U64 values = chunk ^ 0x3030303030303030llu; // Digits become 0..9
+			return (((values & 0x7F7F7F7F7F7F7F7Fllu) + 0x7676767676767676llu) | values) & 0x8080808080808080llu;
+		}
+
+		// Value of 8 digit chars in 3 multiplications instead of 8
+		[[nodiscard]] constexpr U64 ParseEightDigits(U64 chunk)
+		{
+			chunk = ((chunk & 0x0F0F0F0F0F0F0F0Fllu) * 2561llu) >> 8llu;
+			chunk = ((chunk & 0x00FF00FF00FF00FFllu) * 6553601llu) >> 16llu;
+			return ((chunk & 0x0000FFFF0000FFFFllu) * 42949672960001llu) >> 32llu;
+		}
+
+		template<typename CharT>
+		[[nodiscard]] constexpr U64 CountDigits(const CharT* str, U64 size)
+		{
+			U64 count = 0;
+			if constexpr (sizeof(CharT) == 1)
+			{
+				for (; count + 8 <= size; count += 8)
+				{
+					const U64 nonDigits = NonDigitMask(LoadEightChars(str + count));
+					if (nonDigits != 0)
+						return count + std::countr_zero(nonDigits) / 8;
+				}
+			}
+
+			while (count < size && str[count] >= '0' && str[count] <= '9')
+				count++;
+			return count;
+		}
+
+		// At most 19 digits so the value always fits in a U64
+		template<typename CharT>
+		[[nodiscard]] constexpr U64 ParseDigits(const CharT* str, U64 numDigits)
+		{
+			REX_CORE_ASSERT(numDigits <= 19);
+			U64 value = 0;
+			U64 i = 0;
+			if constexpr (sizeof(CharT) == 1)
+			{
+				for (; i + 8 <= numDigits; i += 8)
+					value = value * 100'000'000llu + ParseEightDigits(LoadEightChars(str + i));
+			}
+
+			for (; i < numDigits; i++)
+				value = value * 10llu + static_cast<U64>(str[i] - '0');
+			return value;
+		}
+
+		// Same rules as std::from_chars, an optional '-' for signed types followed by decimal digits
+		template<std::integral T, typename CharT>
+		[[nodiscard]] constexpr std::optional<ParseResult<T>> ParseInt(const CharT* str, U64 size)
+		{
+			U64 start = 0;
+			bool negative = false;
+			if constexpr (std::is_signed_v<T>)
+			{
+				if (size > 0 && str[0] == '-')
+				{
+					negative = true;
+					start = 1;
+				}
+			}
+
+			const U64 numDigits = CountDigits(str + start, size - start);
+			if (numDigits == 0)
+				return std::nullopt;
+
+			const U64 end = start + numDigits;
+			U64 first = start;
+			while (first + 1 < end && str[first] == '0')
+				first++;
+
+			const U64 numSignificant = end - first;
+			if (numSignificant > 20)
+				return std::nullopt;
+
+			U64 value;
+			if (numSignificant == 20)
+			{
+				value = ParseDigits(str + first, 19);
+				const U64 lastDigit = static_cast<U64>(str[first + 19] - '0');
+				if (value > (Math::MaxValue<U64>() - lastDigit) / 10llu)
+					return std::nullopt;
+				value = value * 10llu + lastDigit;
+			}
+			else
+			{
+				value = ParseDigits(str + first, numSignificant);
+			}
+
+			const U64 maxMagnitude = negative ? static_cast<U64>(Math::MaxValue<T>()) + 1llu : static_cast<U64>(Math::MaxValue<T>());
+			if (value > maxMagnitude)
+				return std::nullopt;
+
+			return ParseResult<T>{ static_cast<T>(negative ? 0llu - value : value), end };
+		}
 	}
 
 	// Base for string-like types, see String and StringView
@@ -83,28 +516,80 @@ namespace RexCore
 			self.SplitInto(into, StringViewT(&delimiter, 1));
 		}
 
+		// Will return Size() if not found
+		[[nodiscard]] constexpr U64 Find(this auto&& self, CharT ch, U64 start = 0)
+		{
+			return Internal::StringFindChar(self.Data(), self.Size(), start, ch);
+		}
+
+		// Will return Size() if not found
+		[[nodiscard]] constexpr U64 Find(this auto&& self, StringViewT needle, U64 start = 0)
+		{
+			return Internal::StringFind(self.Data(), self.Size(), start, needle.Data(), needle.Size());
+		}
+
+		// Will return Size() if not found
+		[[nodiscard]] constexpr U64 RFind(this auto&& self, CharT ch)
+		{
+			return Internal::StringRFindChar(self.Data(), self.Size(), ch);
+		}
+
+		// Will return Size() if not found
+		[[nodiscard]] constexpr U64 RFind(this auto&& self, StringViewT needle)
+		{
+			return Internal::StringRFind(self.Data(), self.Size(), needle.Data(), needle.Size());
+		}
+
+		// Index of the first char that is in chars, will return Size() if not found
+		[[nodiscard]] constexpr U64 FindFirstOf(this auto&& self, StringViewT chars, U64 start = 0)
+		{
+			return Internal::StringFindFirstOf(self.Data(), self.Size(), start, chars.Data(), chars.Size());
+		}
+
+		// Index of the last char that is in chars, will return Size() if not found
+		[[nodiscard]] constexpr U64 FindLastOf(this auto&& self, StringViewT chars)
+		{
+			return Internal::StringFindLastOf(self.Data(), self.Size(), chars.Data(), chars.Size());
+		}
+
+		// Parses an integer at the start of the string, std::nullopt if there is no number or it does not fit in T
+		template<std::integral T>
+		[[nodiscard]] constexpr std::optional<ParseResult<T>> ParseInt(this auto&& self)
+		{
+			return Internal::ParseInt<T>(self.Data(), self.Size());
+		}
+
+		// Parses a float at the start of the string with std::from_chars, std::nullopt if there is no number or it is out of range
+		template<std::floating_point T = double>
+		[[nodiscard]] std::optional<ParseResult<T>> ParseFloat(this auto&& self)
+		{
+			static_assert(sizeof(CharT) == 1, "ParseFloat is only available for char strings");
+			T value;
+			const auto [ptr, error] = std::from_chars(self.Data(), self.Data() + self.Size(), value);
+			if (error != std::errc{})
+				return std::nullopt;
+
+			return ParseResult<T>{ value, static_cast<U64>(ptr - self.Data()) };
+		}
+
+		// A delimiter at the end does not add an empty string
 		template<typename IntoT>
 		constexpr void SplitInto(this auto&& self, IntoT& into, StringViewT delimiter)
 		{
-			U64 start = 0;
-			U64 current = 0;
-			while (current < self.Size())
+			const U64 size = self.Size();
+			if (delimiter.IsEmpty())
 			{
-				if (self.SubStr(current, delimiter.Size()) == delimiter)
-				{
-					into.PushBack(self.SubStr(start, current - start));
-					current += delimiter.Size();
-					start = current;
-				}
-				else
-				{
-					current++;
-				}
+				if (size > 0)
+					into.PushBack(self.SubStr(0));
+				return;
 			}
 
-			if (start < self.Size())
+			U64 start = 0;
+			while (start < size)
 			{
-				into.PushBack(self.SubStr(start));
+				const U64 found = self.Find(delimiter, start);
+				into.PushBack(self.SubStr(start, found - start));
+				start = found + delimiter.Size();
 			}
 		}
 
@@ -234,25 +719,39 @@ namespace RexCore
 					 , public StringTypeBase<CharT, StringViewBase<CharT>, StringBase<CharT, Allocator, InplaceSize>>
 	{
 	private:
-		constexpr static U64 SmallStringSize = Math::Max((sizeof(U64) + sizeof(CharT*)) / sizeof(CharT), InplaceSize + 1);
-		constexpr static U64 SmallStringBitMask = (1llu << 63llu);
+		// Small strings store (SmallCapacity - size) in the last char(s) of the storage, when the small string is full
+		// this value is 0 and doubles as the null terminator (23 chars inline for String<>).
+		// Big strings store their capacity in the last 8 bytes of the storage with the highest bit of the last byte set.
+		// This bit is never set by a small string and is used to tell both layouts apart, regardless of endianness.
+		constexpr static U64 MinStorageBytes = sizeof(CharT*) + sizeof(U64) + sizeof(U64);
+		constexpr static U64 CharControlStorageBytes = Math::Max(MinStorageBytes, Math::CeilDiv<U64>((InplaceSize + 1) * sizeof(CharT), 8) * 8);
+		// A single char can hold the remaining size only if it never sets the flag bit, use 8 bytes otherwise
+		constexpr static bool UseCharControl = CharControlStorageBytes / sizeof(CharT) - 1 <= 127;
+		constexpr static U64 StorageBytes = UseCharControl ? CharControlStorageBytes : Math::Max(MinStorageBytes, Math::CeilDiv<U64>(InplaceSize * sizeof(CharT) + sizeof(U64), 8) * 8);
+		constexpr static U64 SmallBufferSize = StorageBytes / sizeof(CharT);
+		constexpr static U64 ControlChars = UseCharControl ? 1 : sizeof(U64) / sizeof(CharT);
+		constexpr static U64 SmallCapacity = SmallBufferSize - ControlChars;
+		constexpr static U64 BigStringFlag = IsLittleEndian() ? (1llu << 63llu) : 0x80llu;
 
 		using BaseT = VectorTypeBase<CharT, U64, StringBase<CharT, Allocator, InplaceSize>>;
+		using BigLayout = Internal::BigStringLayout<CharT, StorageBytes - MinStorageBytes>;
+
+		union Storage {
+			BigLayout m_big;
+			CharT m_small[SmallBufferSize];
+		};
 
 	public:
 		using AllocatorType = Allocator;
 		using StringViewType = StringViewBase<CharT>;
-		constexpr static U64 InplaceCapacity = SmallStringSize - 1;
+		constexpr static U64 InplaceCapacity = SmallCapacity;
 
 		REX_CORE_NO_COPY(StringBase);
 		
 		constexpr StringBase(StringBase&& other) noexcept
-			: m_allocator(other.m_allocator), m_size(other.m_size)
+			: m_allocator(other.m_allocator), m_bigSmallUnion(other.m_bigSmallUnion)
 		{
-			MemCopy(&other.m_bigSmallUnion, &m_bigSmallUnion, sizeof(m_bigSmallUnion));
-
-			MemSet(&other.m_bigSmallUnion, 0, sizeof(m_bigSmallUnion));
-			other.m_size = SmallStringBitMask;
+			other.m_bigSmallUnion = EmptySmallStorage();
 		}
 
 		constexpr StringBase& operator=(StringBase&& other) noexcept {
@@ -262,11 +761,9 @@ namespace RexCore
 			Free();
 
 			m_allocator = other.m_allocator;
-			m_size = other.m_size;
-			MemCopy(&other.m_bigSmallUnion, &m_bigSmallUnion, sizeof(m_bigSmallUnion));
+			m_bigSmallUnion = other.m_bigSmallUnion;
 
-			MemSet(&other.m_bigSmallUnion, 0, sizeof(m_bigSmallUnion));
-			other.m_size = SmallStringBitMask;
+			other.m_bigSmallUnion = EmptySmallStorage();
 			return *this;
 		}
 
@@ -305,8 +802,8 @@ namespace RexCore
 		[[nodiscard]] constexpr const CharT* Data() const { return IsSmallString() ? m_bigSmallUnion.m_small : m_bigSmallUnion.m_big.m_data; }
 		[[nodiscard]] constexpr CharT* Data() { return IsSmallString() ? m_bigSmallUnion.m_small : m_bigSmallUnion.m_big.m_data; }
 		[[nodiscard]] constexpr const CharT* CStr() const { return Data(); }
-		[[nodiscard]] constexpr U64 Size() const { return m_size & (~SmallStringBitMask); }
-		[[nodiscard]] constexpr U64 Capacity() const { return IsSmallString() ? SmallStringSize - 1 : m_bigSmallUnion.m_big.m_capacity; } // -1 for null terminator
+		[[nodiscard]] constexpr U64 Size() const { return IsSmallString() ? SmallCapacity - GetSmallRemaining() : m_bigSmallUnion.m_big.m_size; }
+		[[nodiscard]] constexpr U64 Capacity() const { return IsSmallString() ? SmallCapacity : DecodeCapacity(m_bigSmallUnion.m_big.m_capacity); } // Not counting the null terminator
 		[[nodiscard]] constexpr AllocatorRef<Allocator> GetAllocator() const { return m_allocator; }
 
 		constexpr void Reserve(U64 newCapacity)
@@ -317,16 +814,15 @@ namespace RexCore
 
 			if (IsSmallString())
 			{
+				const U64 size = Size();
 				CharT* newData = static_cast<CharT*>(m_allocator.Allocate((newCapacity + 1) * sizeof(CharT), alignof(CharT)));
-				MemCopy(m_bigSmallUnion.m_small, newData, (Size() + 1) * sizeof(CharT));
-				SetSmallString(false);
-				m_bigSmallUnion.m_big.m_data = newData;
-				m_bigSmallUnion.m_big.m_capacity = newCapacity;
+				MemCopy(m_bigSmallUnion.m_small, newData, (size + 1) * sizeof(CharT));
+				SetBigString(newData, size, newCapacity);
 			}
 			else
 			{
-				m_bigSmallUnion.m_big.m_data = static_cast<CharT*>(m_allocator.Reallocate(m_bigSmallUnion.m_big.m_data, (m_bigSmallUnion.m_big.m_capacity + 1) * sizeof(CharT), (newCapacity + 1) * sizeof(CharT), alignof(CharT)));
-				m_bigSmallUnion.m_big.m_capacity = newCapacity;
+				m_bigSmallUnion.m_big.m_data = static_cast<CharT*>(m_allocator.Reallocate(m_bigSmallUnion.m_big.m_data, (Capacity() + 1) * sizeof(CharT), (newCapacity + 1) * sizeof(CharT), alignof(CharT)));
+				m_bigSmallUnion.m_big.m_capacity = EncodeCapacity(newCapacity);
 			}
 		}
 
@@ -346,24 +842,22 @@ namespace RexCore
 				else
 				{
 					// TODO perf : use Reallocate
-					CharT* oldData = m_bigSmallUnion.m_big.m_data; // Because m_bigSmallUnion.m_small will overwrite m_bigSmallUnion.m_big.m_data
-					CharT* newData = newSize < SmallStringSize ? m_bigSmallUnion.m_small : static_cast<CharT*>(m_allocator.Allocate((newSize + 1) * sizeof(CharT), alignof(CharT)));
-
-					auto oldCapacity = m_bigSmallUnion.m_big.m_capacity;
-					MemCopy(oldData, newData, (newSize + 1) * sizeof(CharT));
-					m_allocator.Free(oldData, (oldCapacity + 1) * sizeof(CharT));
-
+					CharT* oldData = m_bigSmallUnion.m_big.m_data; // Because m_bigSmallUnion.m_small will overwrite m_bigSmallUnion.m_big
+					const U64 oldCapacity = Capacity();
 
-					if (newSize < SmallStringSize)
+					if (newSize <= SmallCapacity)
 					{
-						SetSmallString(true);
+						m_bigSmallUnion = EmptySmallStorage();
+						MemCopy(oldData, m_bigSmallUnion.m_small, newSize * sizeof(CharT));
 					}
 					else
 					{
-						m_bigSmallUnion.m_big.m_data = newData;
-						m_bigSmallUnion.m_big.m_capacity = newSize;
+						CharT* newData = static_cast<CharT*>(m_allocator.Allocate((newSize + 1) * sizeof(CharT), alignof(CharT)));
+						MemCopy(oldData, newData, newSize * sizeof(CharT));
+						SetBigString(newData, newSize, newSize);
 					}
 
+					m_allocator.Free(oldData, (oldCapacity + 1) * sizeof(CharT));
 					SetSize(newSize);
 				}
 			}
@@ -383,10 +877,9 @@ namespace RexCore
 			Base::Clear();
 			if (!IsSmallString())
 			{
-				m_allocator.Free(m_bigSmallUnion.m_big.m_data, (m_bigSmallUnion.m_big.m_capacity + 1) * sizeof(CharT));
+				m_allocator.Free(m_bigSmallUnion.m_big.m_data, (Capacity() + 1) * sizeof(CharT));
 				// Go back to small string
-				SetSmallString(true);
-				SetSize(0);
+				m_bigSmallUnion = EmptySmallStorage();
 			}
 		}
 
@@ -402,43 +895,184 @@ namespace RexCore
 			return *this;
 		}
 
+		StringBase<CharT, Allocator, InplaceSize>& operator+=(CharT rhs)
+		{
+			const U64 size = Size();
+			if (Capacity() == size)
+				Reserve(Internal::CalcGrowSize(Capacity(), size + 1));
+
+			Data()[size] = rhs;
+			SetSize(size + 1);
+			return *this;
+		}
+
+		// Reserves maxSize chars and lets writer fill them, writer(CharT* data, U64 maxSize) returns the new size.
+		// The content is kept up to the current size, the chars after it are uninitialized.
+		template<typename WriterT>
+		constexpr void ResizeAndOverwrite(U64 maxSize, WriterT&& writer)
+		{
+			REX_CORE_TRACE_FUNC();
+			Reserve(maxSize);
+			const U64 newSize = static_cast<U64>(writer(Data(), maxSize));
+			REX_CORE_ASSERT(newSize <= maxSize);
+			SetSize(newSize);
+		}
+
+		template<std::integral T>
+		StringBase<CharT, Allocator, InplaceSize>& AppendInt(T value)
+		{
+			char buffer[24]; // Enough for the 20 digits of U64 max or the sign and 19 digits of S64 min
+			const auto [ptr, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+			return AppendChars(buffer, static_cast<U64>(ptr - buffer));
+		}
+
+		// Shortest representation that round-trips
+		template<std::floating_point T>
+		StringBase<CharT, Allocator, InplaceSize>& AppendFloat(T value)
+		{
+			char buffer[32];
+			const auto [ptr, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+			REX_CORE_ASSERT(error == std::errc{});
+			return AppendChars(buffer, static_cast<U64>(ptr - buffer));
+		}
+
+		// Fixed notation with the given number of decimals
+		template<std::floating_point T>
+		StringBase<CharT, Allocator, InplaceSize>& AppendFloat(T value, S32 precision)
+		{
+			REX_CORE_ASSERT(precision >= 0);
+			// Sign, integer digits (at most exponent * log10(2) + 1 for a value below 2^exponent), point and decimals
+			int exponent = 0;
+			if (std::isfinite(value))
+				std::frexp(value, &exponent);
+			const U64 maxLength = 4 + static_cast<U64>(Math::Max(exponent, 0)) * 30103 / 100000 + static_cast<U64>(Math::Max(precision, 0));
+
+			char buffer[128];
+			if (maxLength <= sizeof(buffer))
+			{
+				const auto [ptr, error] = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, precision);
+				REX_CORE_ASSERT(error == std::errc{});
+				return error == std::errc{} ? AppendChars(buffer, static_cast<U64>(ptr - buffer)) : *this;
+			}
+
+			StringBase<char, Allocator> chars(m_allocator);
+			bool succeeded = false;
+			chars.ResizeAndOverwrite(maxLength, [&](char* data, U64 size) {
+				const auto [ptr, error] = std::to_chars(data, data + size, value, std::chars_format::fixed, precision);
+				succeeded = error == std::errc{};
+				return succeeded ? static_cast<U64>(ptr - data) : 0;
+			});
+			REX_CORE_ASSERT(succeeded);
+			return succeeded ? AppendChars(chars.Data(), chars.Size()) : *this;
+		}
+
 		constexpr operator StringViewType() const { return StringViewType(Data(), Size()); }
 
 	private:
+		StringBase<CharT, Allocator, InplaceSize>& AppendChars(const char* chars, U64 length)
+		{
+			const U64 size = Size();
+			const U64 newSize = size + length;
+			if (Capacity() < newSize)
+				Reserve(Internal::CalcGrowSize(Capacity(), newSize));
+
+			CharT* data = Data() + size;
+			for (U64 i = 0; i < length; i++)
+				data[i] = static_cast<CharT>(chars[i]);
+
+			SetSize(newSize);
+			return *this;
+		}
+
 		constexpr void SetSize(U64 size)
 		{
-			m_size = size | (m_size & SmallStringBitMask); // Preserve the small string bit
+			if (IsSmallString())
+			{
+				REX_CORE_ASSERT(size <= SmallCapacity);
+				SetSmallSize(m_bigSmallUnion, size);
+			}
+			else
+			{
+				m_bigSmallUnion.m_big.m_size = size;
+			}
 			Data()[size] = '\0';
 		}
 
 		constexpr bool IsSmallString() const
 		{
-			return m_size & SmallStringBitMask;
+			// The last byte is either part of the small string size or of the big string capacity
+			if (std::is_constant_evaluated())
+			{
+				// Read through the small chars, the only member that can be active since the allocators aren't constexpr
+				const U64 lastChar = static_cast<U64>(static_cast<std::make_unsigned_t<CharT>>(m_bigSmallUnion.m_small[SmallBufferSize - 1]));
+				const U64 lastByte = IsLittleEndian() ? lastChar >> ((sizeof(CharT) - 1) * 8) : lastChar & 0xFF;
+				return (lastByte & 0x80) == 0;
+			}
+			return (reinterpret_cast<const Byte*>(&m_bigSmallUnion)[StorageBytes - 1] & 0x80) == 0;
+		}
+
+		constexpr void SetBigString(CharT* data, U64 size, U64 capacity)
+		{
+			m_bigSmallUnion.m_big.m_data = data;
+			m_bigSmallUnion.m_big.m_size = size;
+			m_bigSmallUnion.m_big.m_capacity = EncodeCapacity(capacity);
 		}
 
-		constexpr void SetSmallString(bool isSmall)
+		constexpr U64 GetSmallRemaining() const
 		{
-			if (isSmall)
-				m_size |= SmallStringBitMask;
+			if constexpr (UseCharControl)
+			{
+				return static_cast<U64>(static_cast<std::make_unsigned_t<CharT>>(m_bigSmallUnion.m_small[SmallCapacity]));
+			}
 			else
-				m_size &= ~SmallStringBitMask;
+			{
+				std::array<CharT, ControlChars> control;
+				for (U64 i = 0; i < ControlChars; i++)
+					control[i] = m_bigSmallUnion.m_small[SmallCapacity + i];
+
+				const U64 remaining = std::bit_cast<U64>(control);
+				return IsLittleEndian() ? remaining : remaining >> 8llu;
+			}
 		}
 
+		constexpr static void SetSmallSize(Storage& storage, U64 size)
+		{
+			const U64 remaining = SmallCapacity - size;
+			if constexpr (UseCharControl)
+			{
+				storage.m_small[SmallCapacity] = static_cast<CharT>(remaining);
+			}
+			else
+			{
+				const auto control = std::bit_cast<std::array<CharT, ControlChars>>(IsLittleEndian() ? remaining : remaining << 8llu);
+				for (U64 i = 0; i < ControlChars; i++)
+					storage.m_small[SmallCapacity + i] = control[i];
+			}
+		}
+
+		[[nodiscard]] constexpr static Storage EmptySmallStorage()
+		{
+			Storage storage{ .m_small = {} };
+			SetSmallSize(storage, 0);
+			return storage;
+		}
+
+		[[nodiscard]] constexpr static U64 EncodeCapacity(U64 capacity)
+		{
+			return IsLittleEndian() ? (capacity | BigStringFlag) : ((capacity << 8llu) | BigStringFlag);
+		}
+
+		[[nodiscard]] constexpr static U64 DecodeCapacity(U64 encoded)
+		{
+			return IsLittleEndian() ? (encoded & ~BigStringFlag) : (encoded >> 8llu);
+		}
 
 	private:
-		// TODO perf : we could use part of m_size to store longer small strings, but watch out for endianness
-		// The highest bit of m_size is used to determine if the string is small or not
 		[[no_unique_address]] AllocatorRef<Allocator> m_allocator;
-		U64 m_size = SmallStringBitMask;
-		union {
-			struct {
-				U64 m_capacity;
-				CharT* m_data;
-			} m_big = {0, nullptr};
-			CharT m_small[SmallStringSize];
-		} m_bigSmallUnion;
+		Storage m_bigSmallUnion = EmptySmallStorage();
 
-		static_assert(sizeof(decltype(m_bigSmallUnion.m_big)) <= sizeof(decltype(m_bigSmallUnion.m_small)));
+		static_assert(sizeof(BigLayout) == StorageBytes && sizeof(Storage) == StorageBytes);
+		static_assert(SmallCapacity >= InplaceSize);
 
 		using Base = VectorTypeBase<CharT, U64, StringBase<CharT, Allocator, InplaceSize>>;
 		friend class Base;
@@ -491,6 +1125,55 @@ namespace RexCore
 	template<U64 InplaceSize, IAllocator Allocator = DefaultAllocator>
 	using InplaceWString = StringBase<wchar_t, Allocator, InplaceSize>;
 
+	namespace Internal
+	{
+		// Output iterator appending to the end of a StringBase, used to std::format_to directly into a string
+		template<typename StringT>
+		class StringBackInserter
+		{
+		public:
+			using iterator_category = std::output_iterator_tag;
+			using value_type = void;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = void;
+
+			constexpr explicit StringBackInserter(StringT& str) : m_str(&str) {}
+
+			constexpr StringBackInserter& operator=(typename StringT::CharType c)
+			{
+				*m_str += c;
+				return *this;
+			}
+
+			[[nodiscard]] constexpr StringBackInserter& operator*() { return *this; }
+			constexpr StringBackInserter& operator++() { return *this; }
+			constexpr StringBackInserter operator++(int) { return *this; }
+
+		private:
+			StringT* m_str;
+		};
+	}
+
+	// Appends the formatted string to str without going through a std::string
+	template<typename CharT, IAllocator Allocator, U64 InplaceSize, typename ...Args>
+	StringBase<CharT, Allocator, InplaceSize>& FormatTo(StringBase<CharT, Allocator, InplaceSize>& str, std::basic_format_string<std::type_identity_t<CharT>, std::type_identity_t<Args>...> fmt, Args&& ...args)
+	{
+		REX_CORE_TRACE_FUNC();
+		std::format_to(Internal::StringBackInserter(str), fmt, std::forward<Args>(args)...);
+		return str;
+	}
+
+	// Formats into a new string, Format<InplaceString<128>>(...) does not allocate as long as the result fits inplace
+	template<typename StringT = String<>, typename ...Args>
+	[[nodiscard]] StringT Format(std::basic_format_string<typename StringT::CharType, std::type_identity_t<Args>...> fmt, Args&& ...args)
+	{
+		REX_CORE_TRACE_FUNC();
+		StringT str;
+		std::format_to(Internal::StringBackInserter(str), fmt, std::forward<Args>(args)...);
+		return str;
+	}
+
 }
 
 template <>
@@ -507,17 +1190,10 @@ struct std::formatter<RexCore::WStringView, wchar_t> : public std::formatter<std
 	}
 };
 
-template <>
-struct std::formatter<RexCore::String<>> : public std::formatter<std::string_view> {
-	auto format(const RexCore::String<>& str, std::format_context& ctx) const {
-		return std::formatter<std::string_view>::format(std::string_view(str.Data(), str.Size()), ctx);
-	}
-};
-
-template <>
-struct std::formatter<RexCore::WString<>, wchar_t> : public  std::formatter<std::wstring_view, wchar_t> {
-	auto format(const RexCore::WString<>& str, std::wformat_context& ctx) const {
-		return std::formatter<std::wstring_view, wchar_t>::format(std::wstring_view(str.Data(), str.Size()), ctx);
+template <typename CharT, RexCore::IAllocator Allocator, RexCore::U64 InplaceSize>
+struct std::formatter<RexCore::StringBase<CharT, Allocator, InplaceSize>, CharT> : public std::formatter<std::basic_string_view<CharT>, CharT> {
+	auto format(const RexCore::StringBase<CharT, Allocator, InplaceSize>& str, auto& ctx) const {
+		return std::formatter<std::basic_string_view<CharT>, CharT>::format(std::basic_string_view<CharT>(str.Data(), str.Size()), ctx);
 	}
 };
 
@@ -533,15 +1209,10 @@ inline std::wostream& operator<<(std::wostream& os, const RexCore::WStringView&
 	return os;
 }
 
-inline std::ostream& operator<<(std::ostream& os, const RexCore::String<>& str)
+template <typename CharT, RexCore::IAllocator Allocator, RexCore::U64 InplaceSize>
+inline std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, const RexCore::StringBase<CharT, Allocator, InplaceSize>& str)
 {
-	os << std::string_view(str.Data(), str.Size());
-	return os;
-}
-
-inline std::wostream& operator<<(std::wostream& os, const RexCore::WString<>& str)
-{
-	os << std::wstring_view(str.Data(), str.Size());
+	os << std::basic_string_view<CharT>(str.Data(), str.Size());
 	return os;
 }
 
@@ -583,6 +1254,182 @@ struct ankerl::unordered_dense::hash<RexCore::WString<>> {
 
 namespace RexCore
 {
+	namespace Internal
+	{
+		// constexpr port of ankerl::unordered_dense::detail::wyhash::hash(const void*, size_t), both must give the same values
+		namespace ConstexprWyhash
+		{
+			constexpr U64 Secret[4] = { 0xa0761d6478bd642fllu, 0xe7037ed1a0b428dbllu, 0x8ebc6af09c88c6e3llu, 0x589965cc75374cc3llu };
+
+			[[nodiscard]] constexpr U64 Mix(U64 a, U64 b)
+			{
+				// 64x64 -> 128 bits multiplication in 32 bits halves
+				const U64 ha = a >> 32llu;
+				const U64 hb = b >> 32llu;
+				const U64 la = static_cast<U32>(a);
+				const U64 lb = static_cast<U32>(b);
+				const U64 rh = ha * hb;
+				const U64 rm0 = ha * lb;
+				const U64 rm1 = hb * la;
+				const U64 rl = la * lb;
+				const U64 t = rl + (rm0 << 32llu);
+				U64 carry = static_cast<U64>(t < rl);
+				const U64 lo = t + (rm1 << 32llu);
+				carry += static_cast<U64>(lo < t);
+				const U64 hi = rh + (rm0 >> 32llu) + (rm1 >> 32llu) + carry;
+				return lo ^ hi;
+			}
+
+			// Reads in native byte order like the runtime version
+			[[nodiscard]] constexpr U64 Read(const char* p, U64 numBytes)
+			{
+				U64 value = 0;
+				for (U64 i = 0; i < numBytes; i++)
+				{
+					const U64 byte = static_cast<U8>(p[i]);
+					value |= IsLittleEndian() ? byte << (i * 8llu) : byte << ((numBytes - 1 - i) * 8llu);
+				}
+				return value;
+			}
+
+			[[nodiscard]] constexpr U64 Hash(const char* p, U64 len)
+			{
+				U64 seed = Secret[0];
+				U64 a = 0;
+				U64 b = 0;
+				if (len <= 16)
+				{
+					if (len >= 4)
+					{
+						a = (Read(p, 4) << 32llu) | Read(p + ((len >> 3llu) << 2llu), 4);
+						b = (Read(p + len - 4, 4) << 32llu) | Read(p + len - 4 - ((len >> 3llu) << 2llu), 4);
+					}
+					else if (len > 0)
+					{
+						a = (static_cast<U64>(static_cast<U8>(p[0])) << 16llu) | (static_cast<U64>(static_cast<U8>(p[len >> 1llu])) << 8llu) | static_cast<U8>(p[len - 1]);
+					}
+				}
+				else
+				{
+					U64 i = len;
+					if (i > 48)
+					{
+						U64 see1 = seed;
+						U64 see2 = seed;
+						do
+						{
+							seed = Mix(Read(p, 8) ^ Secret[1], Read(p + 8, 8) ^ seed);
+							see1 = Mix(Read(p + 16, 8) ^ Secret[2], Read(p + 24, 8) ^ see1);
+							see2 = Mix(Read(p + 32, 8) ^ Secret[3], Read(p + 40, 8) ^ see2);
+							p += 48;
+							i -= 48;
+						} while (i > 48);
+						seed ^= see1 ^ see2;
+					}
+					while (i > 16)
+					{
+						seed = Mix(Read(p, 8) ^ Secret[1], Read(p + 8, 8) ^ seed);
+						i -= 16;
+						p += 16;
+					}
+					a = Read(p + i - 16, 8);
+					b = Read(p + i - 8, 8);
+				}
+
+				return Mix(Secret[1] ^ len, Mix(a ^ Secret[1], b ^ seed));
+			}
+		}
+	}
+
+	// Same value as HeterogenousStringHash and ankerl::unordered_dense::hash<StringView>, also usable at compile time
+	[[nodiscard]] constexpr U64 HashString(StringView str)
+	{
+		if (std::is_constant_evaluated())
+			return Internal::ConstexprWyhash::Hash(str.Data(), str.Size());
+
+		return ankerl::unordered_dense::hash<StringView>{}(str);
+	}
+
+	// StringView carrying its precomputed hash, looking it up in several StringHashMaps only hashes the string once
+	class HashedStringView
+	{
+	public:
+		constexpr HashedStringView(StringView str, U64 hash)
+			: m_str(str), m_hash(hash)
+		{}
+
+		explicit constexpr HashedStringView(StringView str)
+			: m_str(str), m_hash(HashString(str))
+		{}
+
+		explicit constexpr HashedStringView(const char* nullTerminatedString)
+			: HashedStringView(StringView(nullTerminatedString))
+		{}
+
+		[[nodiscard]] constexpr const char* Data() const { return m_str.Data(); }
+		[[nodiscard]] constexpr U64 Size() const { return m_str.Size(); }
+		[[nodiscard]] constexpr bool IsEmpty() const { return m_str.IsEmpty(); }
+		[[nodiscard]] constexpr StringView GetString() const { return m_str; }
+		[[nodiscard]] constexpr U64 GetHash() const { return m_hash; }
+
+		constexpr operator StringView() const { return m_str; }
+
+		// Different hashes mean different strings, the chars are only compared when the hashes match
+		friend [[nodiscard]] constexpr bool operator==(const HashedStringView& lhs, const HashedStringView& rhs)
+		{
+			return lhs.m_hash == rhs.m_hash && lhs.m_str == rhs.m_str;
+		}
+
+	private:
+		StringView m_str;
+		U64 m_hash;
+	};
+
+	// String owning its chars along with their precomputed hash, see HashedStringView
+	template<IAllocator Allocator = DefaultAllocator>
+	class HashedString
+	{
+	public:
+		REX_CORE_NO_COPY(HashedString);
+		REX_CORE_DEFAULT_MOVE(HashedString);
+
+		explicit HashedString(HashedStringView str, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_str(str.GetString(), allocator), m_hash(str.GetHash())
+		{}
+
+		explicit HashedString(StringView str, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: HashedString(HashedStringView(str), allocator)
+		{}
+
+		explicit HashedString(const char* nullTerminatedString, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: HashedString(HashedStringView(nullTerminatedString), allocator)
+		{}
+
+		[[nodiscard]] HashedString Clone() const
+		{
+			return HashedString(static_cast<HashedStringView>(*this), m_str.GetAllocator());
+		}
+
+		[[nodiscard]] const char* Data() const { return m_str.Data(); }
+		[[nodiscard]] const char* CStr() const { return m_str.CStr(); }
+		[[nodiscard]] U64 Size() const { return m_str.Size(); }
+		[[nodiscard]] bool IsEmpty() const { return m_str.IsEmpty(); }
+		[[nodiscard]] const String<Allocator>& GetString() const { return m_str; }
+		[[nodiscard]] U64 GetHash() const { return m_hash; }
+
+		operator StringView() const { return m_str; }
+		operator HashedStringView() const { return HashedStringView(m_str, m_hash); }
+
+		friend [[nodiscard]] bool operator==(const HashedString& lhs, const HashedString& rhs)
+		{
+			return static_cast<HashedStringView>(lhs) == static_cast<HashedStringView>(rhs);
+		}
+
+	private:
+		String<Allocator> m_str;
+		U64 m_hash;
+	};
+
 	struct HeterogenousStringHash {
 		using is_transparent = void; // enable heterogeneous overloads
 		using is_avalanching = void; // mark class as high quality avalanching hash
@@ -590,5 +1437,46 @@ namespace RexCore
 		[[nodiscard]] U64 operator()(StringView str) const noexcept {
 			return ankerl::unordered_dense::hash<StringView>{}(str);
 		}
+
+		[[nodiscard]] U64 operator()(const HashedStringView& str) const noexcept {
+			return str.GetHash();
+		}
+
+		template<IAllocator Allocator>
+		[[nodiscard]] U64 operator()(const HashedString<Allocator>& str) const noexcept {
+			return str.GetHash();
+		}
 	};
-}
\ No newline at end of file
+}
+
+namespace RexCore::inline Literals
+{
+	consteval StringView operator""_sv(const char* str, std::size_t size)
+	{
+		return StringView(str, size);
+	}
+
+	// Hashed at compile time, "name"_sid.GetHash() can be used as a case label to switch on HashString(str)
+	consteval HashedStringView operator""_sid(const char* str, std::size_t size)
+	{
+		return HashedStringView(StringView(str, size));
+	}
+}
+
+template <>
+struct ankerl::unordered_dense::hash<RexCore::HashedStringView> {
+	using is_avalanching = void;
+
+	[[nodiscard]] RexCore::U64 operator()(const RexCore::HashedStringView& str) const noexcept {
+		return str.GetHash();
+	}
+};
+
+template <RexCore::IAllocator Allocator>
+struct ankerl::unordered_dense::hash<RexCore::HashedString<Allocator>> {
+	using is_avalanching = void;
+
+	[[nodiscard]] RexCore::U64 operator()(const RexCore::HashedString<Allocator>& str) const noexcept {
+		return str.GetHash();
+	}
+};
\ No newline at end of file
@@ -0,0 +1,199 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/containers/string.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/span.hpp>
+
+namespace RexCore
+{
+	// Appends into a list of chunks that are never reallocated, unlike String where growing copies the whole content.
+	// The content can be materialized once with ToString() or written out chunk by chunk with GetChunks(), for instance
+	// by filling the WSABUF/iovec array of a gather write from the views.
+	template<IAllocator Allocator = DefaultAllocator>
+	class StringBuilder
+	{
+	public:
+		using CharType = char;
+		constexpr static U64 DefaultChunkSize = 4096;
+
+		REX_CORE_NO_COPY(StringBuilder);
+
+		StringBuilder(StringBuilder&& other) noexcept
+			: m_allocator(other.m_allocator)
+			, m_chunks(std::move(other.m_chunks))
+			, m_chunkCapacities(std::move(other.m_chunkCapacities))
+			, m_chunkSize(other.m_chunkSize)
+			, m_size(other.m_size)
+			, m_remaining(other.m_remaining)
+		{
+			other.m_size = 0;
+			other.m_remaining = 0;
+		}
+
+		StringBuilder& operator=(StringBuilder&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			Free();
+
+			m_allocator = other.m_allocator;
+			m_chunks = std::move(other.m_chunks);
+			m_chunkCapacities = std::move(other.m_chunkCapacities);
+			m_chunkSize = other.m_chunkSize;
+			m_size = other.m_size;
+			m_remaining = other.m_remaining;
+
+			other.m_size = 0;
+			other.m_remaining = 0;
+			return *this;
+		}
+
+		explicit StringBuilder(U64 chunkSize = DefaultChunkSize, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_allocator(allocator)
+			, m_chunks(allocator)
+			, m_chunkCapacities(allocator)
+			, m_chunkSize(chunkSize)
+		{
+			REX_CORE_ASSERT(chunkSize > 0);
+		}
+
+		~StringBuilder()
+		{
+			Free();
+		}
+
+		[[nodiscard]] U64 Size() const { return m_size; }
+		[[nodiscard]] bool IsEmpty() const { return m_size == 0; }
+		[[nodiscard]] AllocatorRef<Allocator> GetAllocator() const { return m_allocator; }
+
+		// Fills the free space of the last chunk then allocates a single chunk big enough for the rest
+		StringBuilder& Append(StringView str)
+		{
+			REX_CORE_TRACE_FUNC();
+			const char* data = str.Data();
+			U64 size = str.Size();
+
+			const U64 inLastChunk = Math::Min(size, m_remaining);
+			if (inLastChunk > 0)
+			{
+				MemCopy(data, WritePtr(), inLastChunk);
+				Commit(inLastChunk);
+				data += inLastChunk;
+				size -= inLastChunk;
+			}
+
+			if (size > 0)
+			{
+				AddChunk(Math::Max(size, m_chunkSize));
+				MemCopy(data, WritePtr(), size);
+				Commit(size);
+			}
+			return *this;
+		}
+
+		StringBuilder& Append(char c)
+		{
+			if (m_remaining == 0)
+				AddChunk(m_chunkSize);
+
+			*WritePtr() = c;
+			Commit(1);
+			return *this;
+		}
+
+		StringBuilder& operator+=(StringView str) { return Append(str); }
+		StringBuilder& operator+=(char c) { return Append(c); }
+
+		template<typename ...Args>
+		StringBuilder& AppendFormat(std::format_string<Args...> fmt, Args&& ...args)
+		{
+			REX_CORE_TRACE_FUNC();
+			std::format_to(Internal::StringBackInserter(*this), fmt, std::forward<Args>(args)...);
+			return *this;
+		}
+
+		// One view per chunk, in order. Only valid until the next append
+		[[nodiscard]] Span<StringView> GetChunks() const { return m_chunks; }
+
+		// Copies the content in a single allocation
+		template<IAllocator StringAllocator = Allocator>
+		[[nodiscard]] String<StringAllocator> ToString(AllocatorRef<StringAllocator> allocator = AllocatorRefDefaultArg<StringAllocator>()) const
+		{
+			REX_CORE_TRACE_FUNC();
+			String<StringAllocator> result(allocator);
+			result.ResizeAndOverwrite(m_size, [&](char* out, U64) {
+				U64 offset = 0;
+				for (const StringView& chunk : m_chunks)
+				{
+					MemCopy(chunk.Data(), out + offset, chunk.Size());
+					offset += chunk.Size();
+				}
+				return offset;
+			});
+			return result;
+		}
+
+		// Keeps the first chunk to be reused
+		void Clear()
+		{
+			if (m_chunks.IsEmpty())
+				return;
+
+			for (U32 i = 1; i < m_chunks.Size(); i++)
+				m_allocator.Free(const_cast<char*>(m_chunks[i].Data()), m_chunkCapacities[i]);
+
+			const char* first = m_chunks[0].Data();
+			const U64 firstCapacity = m_chunkCapacities[0];
+			m_chunks.Clear();
+			m_chunkCapacities.Clear();
+			m_chunks.PushBack(StringView(first, 0));
+			m_chunkCapacities.PushBack(firstCapacity);
+			m_size = 0;
+			m_remaining = firstCapacity;
+		}
+
+		void Free()
+		{
+			for (U32 i = 0; i < m_chunks.Size(); i++)
+				m_allocator.Free(const_cast<char*>(m_chunks[i].Data()), m_chunkCapacities[i]);
+
+			m_chunks.Free();
+			m_chunkCapacities.Free();
+			m_size = 0;
+			m_remaining = 0;
+		}
+
+	private:
+		void AddChunk(U64 capacity)
+		{
+			char* data = static_cast<char*>(m_allocator.Allocate(capacity, alignof(char)));
+			m_chunks.PushBack(StringView(data, 0));
+			m_chunkCapacities.PushBack(capacity);
+			m_remaining = capacity;
+		}
+
+		[[nodiscard]] char* WritePtr()
+		{
+			const StringView& last = m_chunks.Last();
+			return const_cast<char*>(last.Data()) + last.Size();
+		}
+
+		void Commit(U64 size)
+		{
+			StringView& last = m_chunks.Last();
+			last = StringView(last.Data(), last.Size() + size);
+			m_size += size;
+			m_remaining -= size;
+		}
+
+	private:
+		[[no_unique_address]] AllocatorRef<Allocator> m_allocator;
+		Vector<StringView, Allocator> m_chunks;
+		Vector<U64, Allocator> m_chunkCapacities;
+		U64 m_chunkSize;
+		U64 m_size = 0;
+		U64 m_remaining = 0; // Free chars in the last chunk
+	};
+}
@@ -0,0 +1,207 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/containers/string.hpp>
+#include <rexcore/containers/map.hpp>
+#include <rexcore/containers/set.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/no_destructor.hpp>
+
+#include <rexcore/vendors/unordered_dense.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+namespace RexCore
+{
+	// Handle to a string interned in a StringInterner, only valid for the interner that created it
+	struct StringId
+	{
+		constexpr static U32 InvalidValue = Math::MaxValue<U32>();
+
+		U32 value = InvalidValue;
+
+		[[nodiscard]] constexpr bool IsValid() const { return value != InvalidValue; }
+
+		[[nodiscard]] constexpr bool operator==(const StringId&) const = default;
+		[[nodiscard]] constexpr auto operator<=>(const StringId&) const = default;
+	};
+
+	// Thread safe, interned strings are never moved or freed until the interner is destroyed.
+	// The strings are split in shards by hash, each with its own reader-writer lock and ArenaAllocator,
+	// interning an existing string only takes a shared lock on one shard and GetString() takes no lock.
+	template<IAllocator Allocator = DefaultAllocator>
+	class StringInterner
+	{
+	public:
+		REX_CORE_NO_COPY(StringInterner);
+		REX_CORE_NO_MOVE(StringInterner);
+
+		// maxBytesPerShard is the size of the address space reserved by each shard's ArenaAllocator
+		explicit StringInterner(U64 maxBytesPerShard = 256llu * 1024llu * 1024llu, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+		{
+			for (U32 i = 0; i < NumShards; i++)
+				m_shards.EmplaceBack(maxBytesPerShard, allocator);
+		}
+
+		[[nodiscard]] StringId Intern(StringView str)
+		{
+			REX_CORE_TRACE_FUNC();
+			const U32 shardIndex = ShardIndex(str);
+			Shard& shard = m_shards[shardIndex];
+
+			{
+				std::shared_lock lock(shard.mutex);
+				const auto found = shard.ids.Find(str);
+				if (found != shard.ids.End())
+					return MakeId(shardIndex, found->second);
+			}
+
+			std::unique_lock lock(shard.mutex);
+			const auto found = shard.ids.Find(str); // Another thread might have interned it while we were not holding the lock
+			if (found != shard.ids.End())
+				return MakeId(shardIndex, found->second);
+
+			const U32 localIndex = shard.size.load(std::memory_order_relaxed);
+			REX_CORE_ASSERT(localIndex < MaxStringsPerShard, "Too many interned strings");
+
+			char* chars = static_cast<char*>(shard.arena.Allocate(str.Size() + 1, alignof(char)));
+			MemCopy(str.Data(), chars, str.Size());
+			chars[str.Size()] = '\0';
+
+			const StringView interned(chars, str.Size());
+			shard.NewEntry(localIndex) = interned;
+			shard.ids.Insert(interned, localIndex);
+			shard.size.store(localIndex + 1, std::memory_order_release);
+
+			return MakeId(shardIndex, localIndex);
+		}
+
+		// Returns an invalid id if the string was never interned
+		[[nodiscard]] StringId Find(StringView str) const
+		{
+			REX_CORE_TRACE_FUNC();
+			const U32 shardIndex = ShardIndex(str);
+			const Shard& shard = m_shards[shardIndex];
+
+			std::shared_lock lock(shard.mutex);
+			const auto found = shard.ids.Find(str);
+			if (found == shard.ids.End())
+				return StringId{};
+
+			return MakeId(shardIndex, found->second);
+		}
+
+		// The returned view is null terminated and stays valid for the lifetime of the interner
+		[[nodiscard]] StringView GetString(StringId id) const
+		{
+			REX_CORE_ASSERT(id.IsValid());
+			const Shard& shard = m_shards[id.value & ShardMask];
+			const U32 localIndex = id.value >> ShardBits;
+			REX_CORE_ASSERT(localIndex < shard.size.load(std::memory_order_acquire), "StringId from another interner");
+			return shard.Entry(localIndex);
+		}
+
+		// Number of interned strings
+		[[nodiscard]] U64 Size() const
+		{
+			U64 size = 0;
+			for (const Shard& shard : m_shards)
+				size += shard.size.load(std::memory_order_relaxed);
+			return size;
+		}
+
+	private:
+		constexpr static U32 ShardBits = 4;
+		constexpr static U32 NumShards = 1u << ShardBits;
+		constexpr static U32 ShardMask = NumShards - 1;
+		constexpr static U32 MaxStringsPerShard = (StringId::InvalidValue >> ShardBits);
+
+		// The entries of a shard are stored in chunks of doubling size that are never moved
+		constexpr static U32 FirstChunkSize = 64;
+		constexpr static U32 MaxChunks = 32;
+
+		struct Shard
+		{
+			REX_CORE_NO_COPY(Shard);
+			REX_CORE_NO_MOVE(Shard);
+
+			Shard(U64 maxBytes, AllocatorRef<Allocator> allocator)
+				: ids(allocator), arena(maxBytes)
+			{}
+
+			// Allocates the chunk of the entry if needed, called with the unique lock held
+			StringView& NewEntry(U32 localIndex)
+			{
+				const U32 chunkIndex = ChunkIndex(localIndex);
+				if (chunks[chunkIndex] == nullptr)
+				{
+					const U64 chunkSize = static_cast<U64>(FirstChunkSize) << chunkIndex;
+					chunks[chunkIndex] = static_cast<StringView*>(arena.Allocate(chunkSize * sizeof(StringView), alignof(StringView)));
+				}
+				return chunks[chunkIndex][localIndex - ChunkStart(chunkIndex)];
+			}
+
+			// The chunk of the entry must already be allocated
+			const StringView& Entry(U32 localIndex) const
+			{
+				const U32 chunkIndex = ChunkIndex(localIndex);
+				return chunks[chunkIndex][localIndex - ChunkStart(chunkIndex)];
+			}
+
+			[[nodiscard]] static U32 ChunkIndex(U32 localIndex) { return static_cast<U32>(std::bit_width(localIndex / FirstChunkSize + 1) - 1); }
+			[[nodiscard]] static U32 ChunkStart(U32 chunkIndex) { return FirstChunkSize * ((1u << chunkIndex) - 1); }
+
+			mutable std::shared_mutex mutex;
+			HashMap<StringView, U32, Allocator> ids; // Local index of each string
+			ArenaAllocator arena;
+			StringView* chunks[MaxChunks] = {};
+			std::atomic<U32> size = 0;
+		};
+
+		[[nodiscard]] static U32 ShardIndex(StringView str)
+		{
+			// unordered_dense uses the highest bits for the bucket and the lowest byte as a fingerprint, use bits from the middle
+			const U64 hash = HeterogenousStringHash{}(str);
+			return static_cast<U32>(hash >> 32llu) & ShardMask;
+		}
+
+		[[nodiscard]] static StringId MakeId(U32 shardIndex, U32 localIndex)
+		{
+			return StringId{ (localIndex << ShardBits) | shardIndex };
+		}
+
+	private:
+		FixedVector<Shard, NumShards> m_shards;
+	};
+
+	// Process-wide interner, never destroyed so StringIds stay valid during static destruction
+	inline StringInterner<DefaultNonTrackingAllocator>& GlobalStringInterner()
+	{
+		static NoDestructor<StringInterner<DefaultNonTrackingAllocator>> s_interner;
+		return *s_interner;
+	}
+
+	template<typename Value, IAllocator Allocator = DefaultAllocator>
+	using StringIdHashMap = HashMap<StringId, Value, Allocator>;
+
+	template<IAllocator Allocator = DefaultAllocator>
+	using StringIdHashSet = HashSet<StringId, Allocator, ankerl::unordered_dense::hash<StringId>>;
+}
+
+template <>
+struct ankerl::unordered_dense::hash<RexCore::StringId> {
+	using is_avalanching = void;
+
+	[[nodiscard]] RexCore::U64 operator()(const RexCore::StringId& id) const noexcept {
+		return ankerl::unordered_dense::detail::wyhash::hash(static_cast<RexCore::U64>(id.value));
+	}
+};
+
+template <>
+struct std::formatter<RexCore::StringId> : public std::formatter<RexCore::U32> {
+	auto format(const RexCore::StringId& id, std::format_context& ctx) const {
+		return std::formatter<RexCore::U32>::format(id.value, ctx);
+	}
+};
@@ -0,0 +1,350 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/math.hpp>
+#include <rexcore/simd.hpp>
+#include <rexcore/containers/vector.hpp>
+#include <rexcore/containers/function.hpp>
+
+#include <bit>
+#include <utility>
+
+namespace RexCore
+{
+	namespace Internal
+	{
+		struct TimerNode
+		{
+			TimerNode* next = nullptr; // Overwritten by the pool free list once the node is freed
+			TimerNode** prevNext = nullptr; // Pointer that points to this node, the list head or the next of the previous node
+			U64 id = 0; // 0 once the timer fired or was cancelled
+			U64 expiryTick = 0;
+			U32 listIndex = 0;
+			Function<void()> callback;
+		};
+	}
+
+	// Returned by TimerWheel::Schedule(), stays valid to call Cancel() or IsScheduled() after the timer fired
+	struct TimerHandle
+	{
+		Internal::TimerNode* node = nullptr;
+		U64 id = 0;
+
+		[[nodiscard]] constexpr bool IsValid() const { return node != nullptr; }
+	};
+
+	// Hierarchical timer wheel : 4 levels of 256 slots, a timer is put in the level matching how far its expiry is and moves
+	// down a level each time the wheel reaches its slot, until it lands in the first level and fires. Schedule and Cancel
+	// are O(1) whatever the number of timers, the nodes come from a pool and the callbacks are stored inline.
+	// The time is in nanoseconds from any monotonic clock (Stopwatch::ElapsedNs() for instance) and rounded to ticks of
+	// tickNs, timers fire in the first Advance() that reaches the tick of their deadline so at most one tick late and never
+	// early. The levels cover 2^32 ticks (49 days with 1ms ticks), later deadlines wait in an overflow list.
+	template<IAllocator Allocator = DefaultAllocator>
+	class TimerWheel
+	{
+	public:
+		REX_CORE_NO_COPY(TimerWheel);
+
+		explicit TimerWheel(U64 tickNs = 1'000'000, U64 nowNs = 0, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+			: m_lists(allocator), m_pool(allocator), m_tickNs(tickNs), m_nowNs(nowNs), m_currentTick(nowNs / tickNs)
+		{
+			REX_CORE_ASSERT(tickNs > 0);
+			m_lists.Resize(NumLists, nullptr);
+		}
+
+		TimerWheel(TimerWheel&& other) noexcept
+			: m_lists(std::move(other.m_lists)), m_pool(std::move(other.m_pool)), m_tickNs(other.m_tickNs), m_nowNs(other.m_nowNs),
+			m_currentTick(other.m_currentTick), m_size(std::exchange(other.m_size, 0)), m_lastId(other.m_lastId)
+		{
+			TakeOccupied(other);
+		}
+
+		// The timers of this wheel are cancelled first, their handles must not be used anymore as after destruction
+		TimerWheel& operator=(TimerWheel&& other) noexcept
+		{
+			if (this == &other)
+				return *this;
+
+			REX_CORE_ASSERT(!m_advancing && !other.m_advancing, "A wheel can't be moved from a timer callback");
+			Clear();
+			m_lists = std::move(other.m_lists);
+			m_pool = std::move(other.m_pool);
+			m_tickNs = other.m_tickNs;
+			m_nowNs = other.m_nowNs;
+			m_currentTick = other.m_currentTick;
+			m_size = std::exchange(other.m_size, 0);
+			m_lastId = other.m_lastId;
+			TakeOccupied(other);
+			return *this;
+		}
+
+		~TimerWheel()
+		{
+			Clear();
+		}
+
+		[[nodiscard]] U64 Size() const { return m_size; }
+		[[nodiscard]] bool IsEmpty() const { return m_size == 0; }
+		[[nodiscard]] U64 GetTickNs() const { return m_tickNs; }
+
+		// Time given to the last Advance()
+		[[nodiscard]] U64 GetNowNs() const { return m_nowNs; }
+
+		// A deadline already reached fires in the next Advance()
+		TimerHandle Schedule(U64 deadlineNs, Function<void()> callback)
+		{
+			Internal::TimerNode* node = new (m_pool.AllocateItem()) Internal::TimerNode();
+			node->id = ++m_lastId;
+			node->expiryTick = Math::CeilDiv(deadlineNs, m_tickNs);
+			node->callback = std::move(callback);
+			m_size++;
+
+			if (node->expiryTick <= m_currentTick)
+				Link(node, PendingList);
+			else
+				Place(node);
+			return { node, node->id };
+		}
+
+		TimerHandle ScheduleAfter(U64 delayNs, Function<void()> callback)
+		{
+			return Schedule(m_nowNs + delayNs, std::move(callback));
+		}
+
+		[[nodiscard]] bool IsScheduled(TimerHandle handle) const
+		{
+			// The pool keeps the memory of the freed nodes until the wheel is destroyed, and their id is reset
+			return handle.node != nullptr && handle.node->id == handle.id;
+		}
+
+		// Returns false if the timer already fired or was cancelled
+		bool Cancel(TimerHandle handle)
+		{
+			if (!IsScheduled(handle))
+				return false;
+
+			Unlink(handle.node);
+			FreeNode(handle.node);
+			return true;
+		}
+
+		// Fires the timers whose deadline is before nowNs and returns how many fired, in no particular order within a tick.
+		// The timers of a slot are detached and fired as a batch, their callbacks can schedule or cancel timers (a deadline
+		// before nowNs fires in the next Advance()) but not call Advance().
+		U64 Advance(U64 nowNs)
+		{
+			REX_CORE_TRACE_FUNC();
+			REX_CORE_ASSERT(!m_advancing, "Advance() can't be called from a timer callback");
+			m_advancing = true;
+			m_nowNs = Math::Max(m_nowNs, nowNs);
+
+			U64 fired = FireList(PendingList);
+			const U64 targetTick = nowNs / m_tickNs;
+			while (m_currentTick < targetTick)
+			{
+				// The ticks without any slot to fire or cascade are skipped, so long jumps cost the number of non-empty slots
+				const U64 tick = NextEventTick();
+				if (tick > targetTick)
+				{
+					m_currentTick = targetTick;
+					break;
+				}
+
+				m_currentTick = tick;
+				if ((tick & SlotMask) == 0)
+					Cascade(tick);
+				fired += FireList(static_cast<U32>(tick & SlotMask));
+			}
+
+			m_advancing = false;
+			return fired;
+		}
+
+		// Cancels all the timers
+		void Clear()
+		{
+			for (U32 list = 0; list < m_lists.Size(); list++) // Empty once moved from
+			{
+				Internal::TimerNode* node = m_lists[list];
+				while (node != nullptr)
+				{
+					Internal::TimerNode* next = node->next;
+					FreeNode(node);
+					node = next;
+				}
+				m_lists[list] = nullptr;
+			}
+			for (U64& words : m_occupied)
+				words = 0;
+		}
+
+	private:
+		constexpr static U32 Levels = 4;
+		constexpr static U32 SlotBits = 8;
+		constexpr static U32 SlotsPerLevel = 1u << SlotBits;
+		constexpr static U64 SlotMask = SlotsPerLevel - 1;
+		constexpr static U32 PendingList = Levels * SlotsPerLevel; // Deadlines already reached when scheduled
+		constexpr static U32 OverflowList = PendingList + 1; // Deadlines beyond the last level
+		constexpr static U32 FiringList = PendingList + 2; // Batch being fired
+		constexpr static U32 NumLists = PendingList + 3;
+
+		// Puts the node in the level of the highest bit where its expiry differs from the current tick, the slot is
+		// reached before the current tick changes in any of the bits above
+		void Place(Internal::TimerNode* node)
+		{
+			const U64 diff = node->expiryTick ^ m_currentTick;
+			if ((diff >> (Levels * SlotBits)) != 0)
+			{
+				Link(node, OverflowList);
+				return;
+			}
+
+			const U32 level = diff == 0 ? 0 : static_cast<U32>(std::bit_width(diff) - 1) / SlotBits;
+			Link(node, level * SlotsPerLevel + static_cast<U32>((node->expiryTick >> (level * SlotBits)) & SlotMask));
+		}
+
+		// Called when tick is a multiple of SlotsPerLevel, the slots of the upper levels reached by tick move their timers down
+		void Cascade(U64 tick)
+		{
+			U32 topLevel = 0;
+			while (topLevel + 1 < Levels && (tick & ((1llu << ((topLevel + 1) * SlotBits)) - 1)) == 0)
+				topLevel++;
+
+			if (topLevel == Levels - 1 && (tick & ((1llu << (Levels * SlotBits)) - 1)) == 0)
+				Replace(OverflowList);
+
+			for (U32 level = topLevel; level >= 1; level--)
+				Replace(level * SlotsPerLevel + static_cast<U32>((tick >> (level * SlotBits)) & SlotMask));
+		}
+
+		void Replace(U32 list)
+		{
+			Internal::TimerNode* node = Detach(list);
+			while (node != nullptr)
+			{
+				Internal::TimerNode* next = node->next;
+				Place(node);
+				node = next;
+			}
+		}
+
+		U64 FireList(U32 list)
+		{
+			Internal::TimerNode* node = Detach(list);
+			if (node == nullptr)
+				return 0;
+
+			// Moved to their own list so the callbacks can cancel the timers of the batch that didn't fire yet. Their listIndex
+			// still points to the detached slot, which stays empty since new timers are never put in the current slot.
+			m_lists[FiringList] = node;
+			node->prevNext = &m_lists[FiringList];
+
+			U64 fired = 0;
+			while ((node = m_lists[FiringList]) != nullptr)
+			{
+				if (node->next != nullptr)
+					Prefetch(node->next);
+
+				Unlink(node);
+				Function<void()> callback = std::move(node->callback);
+				FreeNode(node);
+				callback();
+				fired++;
+			}
+			return fired;
+		}
+
+		[[nodiscard]] Internal::TimerNode* Detach(U32 list)
+		{
+			Internal::TimerNode* head = m_lists[list];
+			m_lists[list] = nullptr;
+			if (list < PendingList)
+				m_occupied[list / 64] &= ~(1llu << (list % 64));
+			return head;
+		}
+
+		void Link(Internal::TimerNode* node, U32 list)
+		{
+			Internal::TimerNode*& head = m_lists[list];
+			node->next = head;
+			if (head != nullptr)
+				head->prevNext = &node->next;
+			node->prevNext = &head;
+			node->listIndex = list;
+			head = node;
+			if (list < PendingList)
+				m_occupied[list / 64] |= 1llu << (list % 64);
+		}
+
+		void Unlink(Internal::TimerNode* node)
+		{
+			*node->prevNext = node->next;
+			if (node->next != nullptr)
+				node->next->prevNext = node->prevNext;
+			if (node->listIndex < PendingList && m_lists[node->listIndex] == nullptr)
+				m_occupied[node->listIndex / 64] &= ~(1llu << (node->listIndex % 64));
+		}
+
+		void TakeOccupied(TimerWheel& other)
+		{
+			for (U32 i = 0; i < Levels * SlotsPerLevel / 64; i++)
+				m_occupied[i] = std::exchange(other.m_occupied[i], 0);
+		}
+
+		void FreeNode(Internal::TimerNode* node)
+		{
+			node->id = 0;
+			node->~TimerNode();
+			m_pool.FreeItem(node);
+			m_size--;
+		}
+
+		// The slots of a level only hold timers after the current tick in the current rotation of the level above, so the
+		// first level with an occupied slot after the current one gives the next tick where something happens
+		[[nodiscard]] U64 NextEventTick() const
+		{
+			for (U32 level = 0; level < Levels; level++)
+			{
+				const U32 shift = level * SlotBits;
+				const U32 digit = static_cast<U32>((m_currentTick >> shift) & SlotMask);
+				const U32 slot = NextOccupiedSlot(level, digit + 1);
+				if (slot != SlotsPerLevel)
+					return ((m_currentTick >> (shift + SlotBits)) << (shift + SlotBits)) + (static_cast<U64>(slot) << shift);
+			}
+
+			if (m_lists[OverflowList] != nullptr)
+				return ((m_currentTick >> (Levels * SlotBits)) + 1) << (Levels * SlotBits);
+			return Math::MaxValue<U64>();
+		}
+
+		// First occupied slot of the level from slot, SlotsPerLevel if there is none
+		[[nodiscard]] U32 NextOccupiedSlot(U32 level, U32 slot) const
+		{
+			if (slot >= SlotsPerLevel)
+				return SlotsPerLevel;
+
+			constexpr U32 WordsPerLevel = SlotsPerLevel / 64;
+			const U64* words = m_occupied + level * WordsPerLevel;
+			U32 word = slot / 64;
+			U64 bits = words[word] & (~0llu << (slot % 64));
+			while (bits == 0)
+			{
+				if (++word == WordsPerLevel)
+					return SlotsPerLevel;
+				bits = words[word];
+			}
+			return word * 64 + static_cast<U32>(std::countr_zero(bits));
+		}
+
+	private:
+		Vector<Internal::TimerNode*, Allocator> m_lists; // Heap allocated so the nodes can point to the heads after a move
+		PoolAllocator<Internal::TimerNode, Allocator> m_pool;
+		U64 m_occupied[Levels * SlotsPerLevel / 64] = {}; // One bit per non-empty slot
+		U64 m_tickNs = 0;
+		U64 m_nowNs = 0;
+		U64 m_currentTick = 0; // All the timers up to this tick fired
+		U64 m_size = 0;
+		U64 m_lastId = 0;
+		bool m_advancing = false;
+	};
+}
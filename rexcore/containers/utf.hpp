@@ -0,0 +1,371 @@
+#pragma once
+#include <rexcore/core.hpp>
+#include <rexcore/allocators.hpp>
+#include <rexcore/simd.hpp>
+#include <rexcore/containers/string.hpp>
+
+#include <type_traits>
+
+namespace RexCore
+{
+	namespace Internal
+	{
+		constexpr U32 Utf8ReplacementChar = 0xFFFD;
+
+		struct DecodedCodePoint
+		{
+			U32 codePoint;
+			U32 length;
+			bool valid;
+		};
+
+		// Decodes the multi-byte sequence at the start of str, str[0] must not be ascii.
+		// Invalid sequences (overlong, surrogates, > U+10FFFF, truncated) consume one byte.
+		[[nodiscard]] constexpr DecodedCodePoint DecodeUtf8(const char* str, U64 size)
+		{
+			const U32 lead = static_cast<U8>(str[0]);
+			U32 length;
+			U32 codePoint;
+			U32 minCodePoint;
+			if ((lead & 0xE0) == 0xC0)
+			{
+				length = 2;
+				codePoint = lead & 0x1F;
+				minCodePoint = 0x80;
+			}
+			else if ((lead & 0xF0) == 0xE0)
+			{
+				length = 3;
+				codePoint = lead & 0x0F;
+				minCodePoint = 0x800;
+			}
+			else if ((lead & 0xF8) == 0xF0)
+			{
+				length = 4;
+				codePoint = lead & 0x07;
+				minCodePoint = 0x10000;
+			}
+			else
+			{
+				return { Utf8ReplacementChar, 1, false };
+			}
+
+			if (length > size)
+				return { Utf8ReplacementChar, 1, false };
+
+			for (U32 i = 1; i < length; i++)
+			{
+				const U32 continuation = static_cast<U8>(str[i]);
+				if ((continuation & 0xC0) != 0x80)
+					return { Utf8ReplacementChar, 1, false };
+				codePoint = (codePoint << 6) | (continuation & 0x3F);
+			}
+
+			if (codePoint < minCodePoint || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+				return { Utf8ReplacementChar, 1, false };
+
+			return { codePoint, length, true };
+		}
+
+		// Number of chars to encode codePoint in UTF-8
+		[[nodiscard]] constexpr U32 EncodeUtf8(U32 codePoint, char* out)
+		{
+			if (codePoint < 0x80)
+			{
+				out[0] = static_cast<char>(codePoint);
+				return 1;
+			}
+			if (codePoint < 0x800)
+			{
+				out[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+				out[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+				return 2;
+			}
+			if (codePoint < 0x10000)
+			{
+				out[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+				out[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+				out[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+				return 3;
+			}
+			out[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+			out[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+			out[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			out[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+			return 4;
+		}
+
+		// Length of the run of ascii chars at the start of str, 16 chars at a time
+		[[nodiscard]] inline U64 AsciiPrefixLength(const char* str, U64 size)
+		{
+			U64 i = 0;
+#ifdef REX_CORE_SSE2
+			for (; i + 16 <= size; i += 16)
+			{
+				const U32 nonAscii = static_cast<U32>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i))));
+				if (nonAscii != 0)
+					return i + static_cast<U64>(std::countr_zero(nonAscii));
+			}
+#endif
+			while (i < size && static_cast<U8>(str[i]) < 0x80)
+				i++;
+			return i;
+		}
+
+		// Widens ascii chars, returns the number of chars converted (stops at the first non-ascii char)
+		template<typename WideCharT>
+		[[nodiscard]] inline U64 WidenAscii(const char* str, U64 size, WideCharT* out)
+		{
+			U64 i = 0;
+#ifdef REX_CORE_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			for (; i + 16 <= size; i += 16)
+			{
+				const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+				if (_mm_movemask_epi8(chars) != 0)
+					break;
+
+				const __m128i low = _mm_unpacklo_epi8(chars, zero);
+				const __m128i high = _mm_unpackhi_epi8(chars, zero);
+				if constexpr (sizeof(WideCharT) == 2)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), low);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), high);
+				}
+				else
+				{
+					static_assert(sizeof(WideCharT) == 4);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi16(low, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), _mm_unpackhi_epi16(low, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpacklo_epi16(high, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 12), _mm_unpackhi_epi16(high, zero));
+				}
+			}
+#endif
+			for (; i < size && static_cast<U8>(str[i]) < 0x80; i++)
+				out[i] = static_cast<WideCharT>(str[i]);
+			return i;
+		}
+
+#ifdef REX_CORE_SSE2
+		// (value & mask) == 0, _mm_testz_si128 needs SSE4.1 which is not guaranteed on x64
+		[[nodiscard]] inline bool IsMaskedZero(__m128i value, __m128i mask)
+		{
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(value, mask), _mm_setzero_si128())) == 0xFFFF;
+		}
+#endif
+
+		// Narrows ascii wide chars, returns the number of chars converted (stops at the first non-ascii char)
+		template<typename WideCharT>
+		[[nodiscard]] inline U64 NarrowAscii(const WideCharT* str, U64 size, char* out)
+		{
+			U64 i = 0;
+#ifdef REX_CORE_SSE2
+			for (; i + 16 <= size; i += 16)
+			{
+				__m128i packed;
+				if constexpr (sizeof(WideCharT) == 2)
+				{
+					const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+					const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i + 8));
+					if (!IsMaskedZero(_mm_or_si128(low, high), _mm_set1_epi16(static_cast<short>(0xFF80))))
+						break;
+					packed = _mm_packus_epi16(low, high);
+				}
+				else
+				{
+					static_assert(sizeof(WideCharT) == 4);
+					const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+					const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i + 4));
+					const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i + 8));
+					const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i + 12));
+					const __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+					if (!IsMaskedZero(all, _mm_set1_epi32(static_cast<int>(0xFFFFFF80))))
+						break;
+					packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+			}
+#endif
+			for (; i < size && static_cast<U32>(static_cast<std::make_unsigned_t<WideCharT>>(str[i])) < 0x80; i++)
+				out[i] = static_cast<char>(str[i]);
+			return i;
+		}
+
+		// Number of wide chars Utf8ToWide() writes for str
+		template<typename WideCharT>
+		[[nodiscard]] inline U64 Utf8ToWideLength(const char* str, U64 size)
+		{
+			U64 read = 0;
+			U64 length = 0;
+			while (read < size)
+			{
+				const U64 ascii = AsciiPrefixLength(str + read, size - read);
+				read += ascii;
+				length += ascii;
+				if (read == size)
+					break;
+
+				const DecodedCodePoint decoded = DecodeUtf8(str + read, size - read);
+				read += decoded.length;
+				length += (sizeof(WideCharT) == 2 && decoded.codePoint >= 0x10000) ? 2 : 1; // Surrogate pair
+			}
+			return length;
+		}
+
+		// Returns the number of wide chars written, out must hold exactly Utf8ToWideLength(str, size) chars
+		template<typename WideCharT>
+		[[nodiscard]] inline U64 Utf8ToWide(const char* str, U64 size, WideCharT* out)
+		{
+			U64 read = 0;
+			U64 written = 0;
+			while (read < size)
+			{
+				const U64 ascii = WidenAscii(str + read, size - read, out + written);
+				read += ascii;
+				written += ascii;
+				if (read == size)
+					break;
+
+				const DecodedCodePoint decoded = DecodeUtf8(str + read, size - read);
+				read += decoded.length;
+				if constexpr (sizeof(WideCharT) == 2)
+				{
+					if (decoded.codePoint >= 0x10000)
+					{ // Surrogate pair, the 4 bytes of UTF-8 always give room for the 2 units
+						const U32 offset = decoded.codePoint - 0x10000;
+						out[written++] = static_cast<WideCharT>(0xD800 + (offset >> 10));
+						out[written++] = static_cast<WideCharT>(0xDC00 + (offset & 0x3FF));
+						continue;
+					}
+				}
+				out[written++] = static_cast<WideCharT>(decoded.codePoint);
+			}
+			return written;
+		}
+
+		// Number of chars WideToUtf8() writes for str
+		template<typename WideCharT>
+		[[nodiscard]] inline U64 WideToUtf8Length(const WideCharT* str, U64 size)
+		{
+			U64 length = 0;
+			for (U64 i = 0; i < size; i++)
+			{
+				const U32 unit = static_cast<U32>(static_cast<std::make_unsigned_t<WideCharT>>(str[i]));
+				if (unit < 0x80)
+				{
+					length += 1;
+				}
+				else if (unit < 0x800)
+				{
+					length += 2;
+				}
+				else if (unit < 0x10000 || unit > 0x10FFFF) // Unpaired surrogates and invalid UTF-32 are replaced by U+FFFD
+				{
+					if constexpr (sizeof(WideCharT) == 2)
+					{
+						if (unit >= 0xD800 && unit <= 0xDBFF && i + 1 < size)
+						{
+							const U32 low = static_cast<U32>(static_cast<std::make_unsigned_t<WideCharT>>(str[i + 1]));
+							if (low >= 0xDC00 && low <= 0xDFFF)
+							{
+								length += 4;
+								i++;
+								continue;
+							}
+						}
+					}
+					length += 3;
+				}
+				else
+				{
+					length += 4;
+				}
+			}
+			return length;
+		}
+
+		// Returns the number of chars written, out must hold exactly WideToUtf8Length(str, size) chars
+		template<typename WideCharT>
+		[[nodiscard]] inline U64 WideToUtf8(const WideCharT* str, U64 size, char* out)
+		{
+			U64 read = 0;
+			U64 written = 0;
+			while (read < size)
+			{
+				const U64 ascii = NarrowAscii(str + read, size - read, out + written);
+				read += ascii;
+				written += ascii;
+				if (read == size)
+					break;
+
+				U32 codePoint = static_cast<U32>(static_cast<std::make_unsigned_t<WideCharT>>(str[read++]));
+				if constexpr (sizeof(WideCharT) == 2)
+				{
+					if (codePoint >= 0xD800 && codePoint <= 0xDBFF && read < size)
+					{
+						const U32 low = static_cast<U32>(static_cast<std::make_unsigned_t<WideCharT>>(str[read]));
+						if (low >= 0xDC00 && low <= 0xDFFF)
+						{
+							codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+							read++;
+						}
+					}
+				}
+
+				if ((codePoint >= 0xD800 && codePoint <= 0xDFFF) || codePoint > 0x10FFFF) // Unpaired surrogate or invalid UTF-32
+					codePoint = Utf8ReplacementChar;
+
+				written += EncodeUtf8(codePoint, out + written);
+			}
+			return written;
+		}
+	}
+
+	// True if str is well-formed UTF-8 (no overlong encodings, surrogates or code points above U+10FFFF)
+	[[nodiscard]] inline bool ValidateUtf8(StringView str)
+	{
+		REX_CORE_TRACE_FUNC();
+		const char* data = str.Data();
+		const U64 size = str.Size();
+		U64 i = 0;
+		while (i < size)
+		{
+			i += Internal::AsciiPrefixLength(data + i, size - i);
+			if (i == size)
+				break;
+
+			const Internal::DecodedCodePoint decoded = Internal::DecodeUtf8(data + i, size - i);
+			if (!decoded.valid)
+				return false;
+			i += decoded.length;
+		}
+		return true;
+	}
+
+	// UTF-8 to UTF-16 (UTF-32 where wchar_t is 4 bytes), invalid sequences are replaced by U+FFFD
+	template<IAllocator Allocator = DefaultAllocator>
+	[[nodiscard]] WString<Allocator> ToWide(StringView str, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+	{
+		REX_CORE_TRACE_FUNC();
+		// Sized by a first pass, reserving one unit per char would keep up to 3 times the needed capacity
+		WString<Allocator> result(allocator);
+		result.ResizeAndOverwrite(Internal::Utf8ToWideLength<wchar_t>(str.Data(), str.Size()), [&](wchar_t* out, U64) {
+			return Internal::Utf8ToWide(str.Data(), str.Size(), out);
+		});
+		return result;
+	}
+
+	// UTF-16 (UTF-32 where wchar_t is 4 bytes) to UTF-8, unpaired surrogates are replaced by U+FFFD
+	template<IAllocator Allocator = DefaultAllocator>
+	[[nodiscard]] String<Allocator> ToUtf8(WStringView str, AllocatorRef<Allocator> allocator = AllocatorRefDefaultArg<Allocator>())
+	{
+		REX_CORE_TRACE_FUNC();
+		// Sized by a first pass, reserving the worst case of 3 chars per unit would keep up to 3 times the needed capacity
+		String<Allocator> result(allocator);
+		result.ResizeAndOverwrite(Internal::WideToUtf8Length(str.Data(), str.Size()), [&](char* out, U64) {
+			return Internal::WideToUtf8(str.Data(), str.Size(), out);
+		});
+		return result;
+	}
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+// SSE2 is always available on x64, AVX2 must be enabled by the compiler (/arch:AVX2 or -mavx2)
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define REX_CORE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define REX_CORE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace RexCore
+{
+	// Hint to bring the cache line holding ptr in all the cache levels
+	inline void Prefetch(const void* ptr)
+	{
+#if defined(REX_CORE_SSE2)
+		_mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(ptr);
+#else
+		(void)ptr;
+#endif
+	}
+}
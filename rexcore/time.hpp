@@ -5,6 +5,7 @@
 
 namespace RexCore
 {
+	// Uses the monotonic clock, the elapsed time is not affected by changes of the system time
 	class Stopwatch
 	{
 	public:
@@ -15,16 +16,16 @@ namespace RexCore
 
 		void Restart()
 		{
-			m_startTime = std::chrono::high_resolution_clock::now();
+			m_startTime = std::chrono::steady_clock::now();
 		}
 
 		U64 ElapsedNs()
 		{
-			auto end = std::chrono::high_resolution_clock::now();
+			auto end = std::chrono::steady_clock::now();
 			return static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_startTime).count());
 		}
 
 	private:
-		std::chrono::high_resolution_clock::time_point m_startTime;
+		std::chrono::steady_clock::time_point m_startTime;
 	};
 }
\ No newline at end of file
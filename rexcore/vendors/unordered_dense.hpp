@@ -1116,11 +1116,15 @@ private:
 
     template <typename K>
     auto do_find(K const& key) -> iterator {
+        return do_find(key, mixed_hash(key));
+    }
+
+    template <typename K>
+    auto do_find(K const& key, uint64_t mh) -> iterator {
         if (ANKERL_UNORDERED_DENSE_UNLIKELY(empty())) {
             return end();
         }
 
-        auto mh = mixed_hash(key);
         auto dist_and_fingerprint = dist_and_fingerprint_from_hash(mh);
         auto bucket_idx = bucket_idx_from_hash(mh);
         auto* bucket = &at(m_buckets, bucket_idx);
@@ -1769,6 +1773,36 @@ public:
         return find(key) == end() ? 0 : 1;
     }
 
+    // RexCore addition for batched lookups: hash the keys and prefetch their memory before calling find_hashed()
+    template <class K>
+    [[nodiscard]] auto hash_key(K const& key) const -> uint64_t {
+        return mixed_hash(key);
+    }
+
+    // Address of the first bucket probed for this hash, nullptr if the table is empty
+    [[nodiscard]] auto bucket_address(uint64_t mh) const -> void const* {
+        return empty() ? nullptr : &at(m_buckets, bucket_idx_from_hash(mh));
+    }
+
+    // Address of the value referenced by the first bucket probed for this hash, nullptr if there is none
+    [[nodiscard]] auto value_address(uint64_t mh) const -> void const* {
+        if (empty()) {
+            return nullptr;
+        }
+        auto const& bucket = at(m_buckets, bucket_idx_from_hash(mh));
+        return bucket.m_dist_and_fingerprint == 0 ? nullptr : &m_values[bucket.m_value_idx];
+    }
+
+    template <class K>
+    auto find_hashed(K const& key, uint64_t mh) -> iterator {
+        return do_find(key, mh);
+    }
+
+    template <class K>
+    auto find_hashed(K const& key, uint64_t mh) const -> const_iterator {
+        return const_cast<table*>(this)->do_find(key, mh); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+
     auto find(Key const& key) -> iterator {
         return do_find(key);
     }
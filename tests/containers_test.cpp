@@ -10,7 +10,24 @@
 #include <rexcore/containers/stack.hpp>
 #include <rexcore/containers/ring_buffer.hpp>
 #include <rexcore/containers/no_destructor.hpp>
+#include <rexcore/containers/string_interner.hpp>
+#include <rexcore/containers/utf.hpp>
+#include <rexcore/containers/string_builder.hpp>
+#include <rexcore/containers/constexpr_map.hpp>
+#include <rexcore/containers/concurrent_map.hpp>
+#include <rexcore/containers/incremental_map.hpp>
+#include <rexcore/containers/lru_cache.hpp>
+#include <rexcore/containers/flat_map.hpp>
+#include <rexcore/containers/btree_map.hpp>
+#include <rexcore/containers/slot_map.hpp>
+#include <rexcore/containers/sparse_set.hpp>
+#include <rexcore/containers/bit_vector.hpp>
+#include <rexcore/containers/filters.hpp>
+#include <rexcore/containers/priority_queue.hpp>
+#include <rexcore/containers/timer_wheel.hpp>
+#include <rexcore/containers/intrusive_list.hpp>
 #include <rexcore/math.hpp>
+#include <rexcore/iterators.hpp>
 #include <rexcore/time.hpp>
 
 #include <thread>
@@ -958,6 +975,47 @@ void TestStringTypeBase(const ViewT& view, Args&& ...args)
 		}
 	}
 
+	{ // Find, RFind, FindFirstOf, FindLastOf
+		if constexpr (std::is_same_v<CharT, char>)
+		{
+			ViewT v("abcabc-xyz", args...);
+			ASSERT(v.Find('b') == 1);
+			ASSERT(v.Find('b', 2) == 4);
+			ASSERT(v.Find('q') == v.Size());
+			ASSERT(v.Find("bc") == 1);
+			ASSERT(v.Find("bc", 2) == 4);
+			ASSERT(v.Find("xyz") == 7);
+			ASSERT(v.Find("xyzw") == v.Size());
+			ASSERT(v.RFind('c') == 5);
+			ASSERT(v.RFind("abc") == 3);
+			ASSERT(v.RFind("q") == v.Size());
+			ASSERT(v.FindFirstOf("zc") == 2);
+			ASSERT(v.FindFirstOf("zc", 6) == 9);
+			ASSERT(v.FindFirstOf("qr") == v.Size());
+			ASSERT(v.FindLastOf("ab") == 4);
+			ASSERT(v.FindLastOf("qr") == v.Size());
+		}
+		else
+		{
+			ViewT v(L"abcabc-xyz", args...);
+			ASSERT(v.Find(L'b') == 1);
+			ASSERT(v.Find(L'b', 2) == 4);
+			ASSERT(v.Find(L'q') == v.Size());
+			ASSERT(v.Find(L"bc") == 1);
+			ASSERT(v.Find(L"bc", 2) == 4);
+			ASSERT(v.Find(L"xyz") == 7);
+			ASSERT(v.Find(L"xyzw") == v.Size());
+			ASSERT(v.RFind(L'c') == 5);
+			ASSERT(v.RFind(L"abc") == 3);
+			ASSERT(v.RFind(L"q") == v.Size());
+			ASSERT(v.FindFirstOf(L"zc") == 2);
+			ASSERT(v.FindFirstOf(L"zc", 6) == 9);
+			ASSERT(v.FindFirstOf(L"qr") == v.Size());
+			ASSERT(v.FindLastOf(L"ab") == 4);
+			ASSERT(v.FindLastOf(L"qr") == v.Size());
+		}
+	}
+
 	{ // SplitInto
 		if constexpr (std::is_same_v<CharT, char>)
 		{
@@ -1142,6 +1200,50 @@ TEST_CASE("Containers/StringView")
 {
 	[[maybe_unused]] StringView view = "Hello 123"; // Implicit conversion from c-style string
 	TestStringView<String<>>();
+
+	{ // Search across multiple SIMD blocks
+		String<> str;
+		for (U32 i = 0; i < 20; i++)
+			str += "0123456789abcdef";
+		str += "needle";
+		str += "0123456789abcdef";
+
+		const StringView view = str;
+		ASSERT(view.Find("needle") == 320);
+		ASSERT(view.RFind("needle") == 320);
+		ASSERT(view.Find('n') == 320);
+		ASSERT(view.RFind('f') == view.Size() - 1);
+		ASSERT(view.Find("needles") == view.Size());
+		ASSERT(view.FindFirstOf("ed") == 13);
+		ASSERT(view.FindFirstOf("ln") == 320);
+		ASSERT(view.FindLastOf("ln") == 324);
+		ASSERT(view.Find("0123", 1) == 16);
+
+		InplaceVector<StringView, 4> split;
+		view.SplitInto(split, "needle");
+		ASSERT(split.Size() == 2);
+		ASSERT(split[0].Size() == 320);
+		ASSERT(split[1] == "0123456789abcdef");
+	}
+
+	{ // Number parsing
+		const auto parsed = StringView("123456789012,rest").ParseInt<U64>();
+		ASSERT(parsed && parsed->value == 123456789012llu && parsed->length == 12);
+
+		ASSERT(StringView("-128").ParseInt<S8>()->value == -128);
+		ASSERT(!StringView("128").ParseInt<S8>());
+		ASSERT(!StringView("-1").ParseInt<U32>());
+		ASSERT(!StringView("abc").ParseInt<S32>());
+		ASSERT(StringView("18446744073709551615").ParseInt<U64>()->value == Math::MaxValue<U64>());
+		ASSERT(!StringView("18446744073709551616").ParseInt<U64>());
+		ASSERT(StringView("-9223372036854775808").ParseInt<S64>()->value == Math::MinValue<S64>());
+		ASSERT(StringView("0000000000000000000042").ParseInt<U8>()->value == 42);
+
+		const auto parsedFloat = StringView("-1.5e3 ").ParseFloat();
+		ASSERT(parsedFloat && parsedFloat->value == -1500.0 && parsedFloat->length == 6);
+		ASSERT(StringView("0.1").ParseFloat<float>()->value == 0.1f);
+		ASSERT(!StringView("x1.0").ParseFloat());
+	}
 }
 
 TEST_CASE("Containers/WStringView")
@@ -1302,11 +1404,104 @@ void TestString(Args&& ...args)
 	}
 }
 
+// Every size up to the inplace capacity must round-trip through the remaining size stored in the control char(s) and
+// stay in the object, one more char moves the string to the heap
+template<typename StringT>
+void TestSmallStringSizes(U64 expectedCapacity)
+{
+	using CharT = typename StringT::CharType;
+	constexpr U64 Capacity = StringT::InplaceCapacity;
+	ASSERT(Capacity == expectedCapacity);
+
+	StringT str;
+	for (U64 size = 0; size <= Capacity; size++)
+	{
+		str.Resize(size, static_cast<CharT>('a' + size % 26));
+		ASSERT(str.Size() == size);
+		ASSERT(str.Capacity() == Capacity);
+		ASSERT(static_cast<const void*>(str.Data()) >= static_cast<const void*>(&str));
+		ASSERT(static_cast<const void*>(str.Data() + size) < static_cast<const void*>(&str + 1));
+		ASSERT(str.Data()[size] == CharT(0));
+	}
+
+	str += static_cast<CharT>('x'); // Moves to the heap
+	ASSERT(str.Size() == Capacity + 1);
+	ASSERT(str.Capacity() > Capacity);
+
+	str.Resize(Capacity); // Back to the inplace buffer
+	ASSERT(str.Capacity() == Capacity);
+	for (U64 i = 0; i < Capacity; i++)
+		ASSERT(str[i] == static_cast<CharT>('a' + (i + 1) % 26));
+}
+
 TEST_CASE("Containers/String")
 {
 	ArenaAllocator arena;
 	TestString<String<>>();
 	TestString<String<ArenaAllocator>>(arena);
+
+	{ // Small string optimization
+		String<> str("0123456789abcdefghijklm"); // 23 chars
+		ASSERT(str.Size() == 23);
+		ASSERT(str.Capacity() == 23);
+		ASSERT(static_cast<const void*>(str.Data()) >= static_cast<const void*>(&str));
+		ASSERT(static_cast<const void*>(str.Data()) < static_cast<const void*>(&str + 1));
+		ASSERT(str.Data()[23] == '\0');
+		ASSERT(str == "0123456789abcdefghijklm");
+
+		str += "n"; // Moves to the heap
+		ASSERT(str.Size() == 24);
+		ASSERT(str.Capacity() >= 24);
+		ASSERT(str == "0123456789abcdefghijklmn");
+
+		str.Resize(23); // Back to the inplace buffer
+		ASSERT(str.Capacity() == 23);
+		ASSERT(str == "0123456789abcdefghijklm");
+	}
+
+	TestSmallStringSizes<String<>>(23);
+
+	// The small string layout stays usable at compile time
+	static_assert([] {
+		InplaceString<200> str; // 8 bytes of control
+		str.Resize(3, 'a');
+		return str.Size() == 3 && str.Capacity() == 200 && str.Data()[2] == 'a' && str.Data()[3] == '\0';
+	}());
+	static_assert([] {
+		WString<> str;
+		str.Resize(2, L'b');
+		return str.Size() == 2 && str.Data()[1] == L'b';
+	}());
+
+	{ // Number formatting
+		String<> str;
+		str.AppendInt(-42).AppendInt(Math::MaxValue<U64>());
+		ASSERT(str == "-4218446744073709551615");
+
+		str.Clear();
+		str.AppendFloat(0.1).AppendFloat(1e300).AppendFloat(-2.5f);
+		ASSERT(str == "0.11e+300-2.5");
+		ASSERT(str.SubStr(0, 3).ParseFloat()->value == 0.1);
+
+		str.Clear();
+		str.AppendFloat(3.14159, 2);
+		ASSERT(str == "3.14");
+
+		str.Clear();
+		str.AppendFloat(1e308, 300); // 309 integer digits and 300 decimals
+		ASSERT(str.Size() == 610);
+		ASSERT(str.StartsWith("1000000000000000010") && str[309] == '.');
+
+		str.Clear();
+		str.AppendFloat(1e-5, 600);
+		ASSERT(str.Size() == 602);
+		ASSERT(str.StartsWith("0.0000100000000000000008"));
+
+		WString<> wstr;
+		wstr.AppendInt(Math::MinValue<S64>());
+		ASSERT(wstr == L"-9223372036854775808");
+		ASSERT(wstr.ParseInt<S64>()->value == Math::MinValue<S64>());
+	}
 }
 
 TEST_CASE("Containers/WString")
@@ -1314,6 +1509,7 @@ TEST_CASE("Containers/WString")
 	ArenaAllocator arena;
 	TestString<WString<>>();
 	TestString<WString<ArenaAllocator>>(arena);
+	TestSmallStringSizes<WString<>>(sizeof(wchar_t) == 2 ? 11 : 5);
 }
 
 TEST_CASE("Containers/InplaceString")
@@ -1321,6 +1517,10 @@ TEST_CASE("Containers/InplaceString")
 	ArenaAllocator arena;
 	TestString<InplaceString<32>>();
 	TestString<InplaceString<32, ArenaAllocator>>(arena);
+
+	TestSmallStringSizes<InplaceString<127>>(127); // Largest size with a single control char
+	TestSmallStringSizes<InplaceString<128>>(128); // 8 bytes of control
+	TestSmallStringSizes<InplaceString<200>>(200);
 }
 
 TEST_CASE("Containers/InplaceWString")
@@ -1328,6 +1528,92 @@ TEST_CASE("Containers/InplaceWString")
 	ArenaAllocator arena;
 	TestString<InplaceWString<32>>();
 	TestString<InplaceWString<32, ArenaAllocator>>(arena);
+	TestSmallStringSizes<InplaceWString<128>>(128);
+}
+
+TEST_CASE("Containers/StringBuilder")
+{
+	StringBuilder<> builder(16);
+	ASSERT(builder.IsEmpty());
+	ASSERT(builder.ToString() == "");
+
+	builder.Append("Hello").Append(',').Append(' ');
+	builder += "a string longer than the chunk size";
+	builder.AppendFormat(" {}+{}={}", 1, 2, 3);
+	ASSERT(builder.Size() == 48);
+
+	const String<> str = builder.ToString();
+	ASSERT(str == "Hello, a string longer than the chunk size 1+2=3");
+
+	{ // The chunks concatenated give the same content
+		U64 offset = 0;
+		for (const StringView& chunk : builder.GetChunks())
+		{
+			ASSERT(!chunk.IsEmpty());
+			ASSERT(str.SubStr(offset, chunk.Size()) == chunk);
+			offset += chunk.Size();
+		}
+		ASSERT(offset == str.Size());
+		ASSERT(builder.GetChunks().Size() > 1);
+	}
+
+	builder.Clear();
+	ASSERT(builder.IsEmpty());
+	builder += "Reused";
+	ASSERT(builder.ToString() == "Reused");
+	ASSERT(builder.GetChunks().Size() == 1);
+
+	StringBuilder<> moved = std::move(builder);
+	ASSERT(builder.IsEmpty());
+	ASSERT(moved.ToString() == "Reused");
+
+	ArenaAllocator arena;
+	StringBuilder<ArenaAllocator> arenaBuilder(StringBuilder<ArenaAllocator>::DefaultChunkSize, arena);
+	arenaBuilder.AppendFormat("{}", 42);
+	ASSERT(arenaBuilder.ToString<DefaultAllocator>() == "42");
+}
+
+TEST_CASE("Containers/Utf")
+{
+	{ // Ascii, long enough for the SIMD paths
+		const StringView ascii = "The quick brown fox jumps over the lazy dog 0123456789";
+		const WString<> wide = ToWide(ascii);
+		ASSERT(wide == L"The quick brown fox jumps over the lazy dog 0123456789");
+		ASSERT(ToUtf8(wide) == ascii);
+		ASSERT(ToUtf8(wide).Capacity() == ascii.Size()); // Sized exactly, not for the worst case
+		ASSERT(ValidateUtf8(ascii));
+	}
+
+	{ // 2, 3 and 4 bytes sequences mixed with ascii
+		const StringView utf8 = "caf\xC3\xA9 \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E \xF0\x9F\x98\x80 and some more ascii after";
+		ASSERT(ValidateUtf8(utf8));
+
+		const WString<> wide = ToWide(utf8);
+		ASSERT(wide.StartsWith(L"caf\u00E9 \u65E5\u672C\u8A9E "));
+		ASSERT(wide.EndsWith(L" and some more ascii after"));
+		ASSERT(wide.Size() == (sizeof(wchar_t) == 2 ? 37u : 36u)); // The emoji is a surrogate pair in UTF-16
+		ASSERT(wide.Capacity() == wide.Size()); // Sized exactly, not one unit per char
+		ASSERT(ToUtf8(wide) == utf8);
+		ASSERT(ToUtf8(wide).Capacity() == utf8.Size());
+	}
+
+	{ // Invalid sequences
+		ASSERT(!ValidateUtf8("\xC0\x80")); // Overlong
+		ASSERT(!ValidateUtf8("\xED\xA0\x80")); // Surrogate
+		ASSERT(!ValidateUtf8("\xF4\x90\x80\x80")); // Above U+10FFFF
+		ASSERT(!ValidateUtf8("abc\xE6\x97")); // Truncated
+
+		ASSERT(ToWide("a\xFFz") == L"a\uFFFDz");
+
+		const wchar_t loneSurrogate[] = { L'a', static_cast<wchar_t>(0xD800), L'z', 0 };
+		ASSERT(ToUtf8(loneSurrogate) == "a\xEF\xBF\xBDz");
+	}
+
+	{
+		ArenaAllocator arena;
+		const String<ArenaAllocator> utf8 = ToUtf8<ArenaAllocator>(L"Arena", arena);
+		ASSERT(utf8 == "Arena");
+	}
 }
 
 TEST_CASE("Containers/HashMap")
@@ -1415,6 +1701,179 @@ TEST_CASE("Containers/HashMap")
 		ASSERT(strMap.Contains(StringView("Hello")));
 		ASSERT(strMap.Contains(String("Hello")));
 	}
+
+	{ // Batched lookups, more keys than a single batch
+		HashMap<U32, U32> bigMap;
+		Vector<U32> keys;
+		for (U32 i = 0; i < 100; i++)
+		{
+			bigMap.Insert(i * 2, i);
+			keys.PushBack(i);
+		}
+
+		Vector<HashMap<U32, U32>::Iterator> found;
+		found.Resize(keys.Size());
+		bigMap.FindBatch(keys, found.Data());
+
+		bool contains[100];
+		bigMap.ContainsBatch(keys, contains);
+
+		const HashMap<U32, U32>& constMap = bigMap;
+		Vector<HashMap<U32, U32>::ConstIterator> constFound;
+		constFound.Resize(keys.Size());
+		constMap.FindBatch(keys, constFound.Data());
+
+		for (U32 i = 0; i < 100; i++)
+		{
+			ASSERT(contains[i] == (i % 2 == 0));
+			ASSERT((found[i] != bigMap.End()) == (i % 2 == 0));
+			ASSERT(found[i] == bigMap.Find(i));
+			ASSERT(constFound[i] == constMap.Find(i));
+			if (i % 2 == 0)
+				ASSERT(found[i]->second == i / 2);
+		}
+
+		HashMap<U32, U32> emptyMap;
+		emptyMap.ContainsBatch(keys, contains);
+		ASSERT(!contains[0] && !contains[99]);
+	}
+
+	{ // Precomputed hashes
+		const HashedStringView key("Hello");
+		ASSERT(key.GetHash() == HeterogenousStringHash{}(StringView("Hello")));
+		ASSERT(key == HashedStringView(StringView("Hello")));
+		ASSERT(key != HashedStringView("Hello2"));
+
+		StringHashMap<U32> strMap;
+		strMap.Insert(key, 1);
+		strMap.Insert("Hello2", 2);
+
+		ASSERT(strMap.At(key) == 1);
+		ASSERT(strMap.Find(key)->second == 1);
+		ASSERT(strMap.Contains(HashedStringView("Hello2")));
+		ASSERT(!strMap.Contains(HashedStringView("Hello3")));
+
+		const HashedString<> owned("Hello2");
+		ASSERT(owned.GetHash() == HashedStringView("Hello2").GetHash());
+		ASSERT(strMap.At(owned) == 2);
+		ASSERT(owned.Clone() == owned);
+
+		static_assert(HashString("Hello") == "Hello"_sid.GetHash());
+		static_assert("Hello"_sv.Size() == 5);
+		ASSERT("Hello"_sid == key);
+		ASSERT(HashString(StringView("a string longer than 48 chars to test the long path")) == "a string longer than 48 chars to test the long path"_sid.GetHash());
+		ASSERT(strMap.At("Hello2"_sid) == 2);
+
+		const auto dispatch = [](StringView command) {
+			switch (HashString(command))
+			{
+			case "start"_sid.GetHash(): return command == "start" ? 1 : 0;
+			case "stop"_sid.GetHash(): return command == "stop" ? 2 : 0;
+			default: return 0;
+			}
+		};
+		ASSERT(dispatch("start") == 1);
+		ASSERT(dispatch("stop") == 2);
+		ASSERT(dispatch("restart") == 0);
+
+		HashMap<HashedString<>, U32, DefaultAllocator, HeterogenousStringHash> hashedMap;
+		hashedMap.Insert(HashedString<>("Hello"), 1);
+		ASSERT(hashedMap.At(key) == 1);
+		ASSERT(hashedMap.At(StringView("Hello")) == 1);
+	}
+}
+
+TEST_CASE("Containers/ConstexprMap")
+{
+	constexpr auto keywords = MakeConstexprMap<StringView, U32>({
+		{ "if", 1 }, { "else", 2 }, { "while", 3 }, { "for", 4 }, { "return", 5 }, { "break", 6 }, { "continue", 7 },
+		{ "switch", 8 }, { "case", 9 }, { "default", 10 }, { "struct", 11 }, { "class", 12 }, { "enum", 13 },
+	});
+
+	static_assert(keywords.Size() == 13);
+	static_assert(keywords.At("while") == 3);
+	static_assert(keywords.Contains("enum"));
+	static_assert(!keywords.Contains("goto"));
+
+	ASSERT(keywords.At(String<>("return")) == 5);
+	ASSERT(keywords.Find("class")->second == 12);
+	ASSERT(keywords.Find("") == keywords.End());
+
+	U32 sum = 0;
+	for (const auto& [key, value] : keywords)
+		sum += value;
+	ASSERT(sum == 91);
+
+	enum class Color : U8 { Red, Green, Blue };
+	constexpr auto colors = MakeConstexprMap<Color, StringView>({ { Color::Red, "red" }, { Color::Green, "green" }, { Color::Blue, "blue" } });
+	static_assert(colors.At(Color::Green) == "green");
+
+	constexpr auto single = MakeConstexprMap<U64, U64>({ { 42, 1 } });
+	ASSERT(single.Contains(42) && !single.Contains(41));
+}
+
+TEST_CASE("Containers/SegmentedHashMap")
+{
+	SegmentedHashMap<U32, U32> map;
+	map.Insert(1u, 10u);
+	const U32* first = &map.At(1u);
+	for (U32 i = 2; i < 10'000; i++)
+		map.Insert(i, i * 10);
+
+	ASSERT(map.Size() == 9'999);
+	ASSERT(&map.At(1u) == first); // Growing doesn't move the values
+	ASSERT(map.Capacity() >= map.Size());
+	ASSERT(map.Find(5u)->second == 50);
+
+	SegmentedHashMap<U32, U32> clone = map.Clone();
+	ASSERT(clone == map);
+	ASSERT(clone.Extract(clone.Find(5u)) == std::pair<U32, U32>(5u, 50u));
+	ASSERT(!clone.Contains(5u));
+	ASSERT(clone.Size() == 9'998);
+}
+
+TEST_CASE("Containers/IncrementalHashMap")
+{
+	IncrementalHashMap<U32, U32> map;
+	ASSERT(map.IsEmpty());
+	ASSERT(map.Find(1u) == nullptr);
+
+	bool rehashed = false;
+	for (U32 i = 0; i < 100'000; i++)
+	{
+		ASSERT(map.Insert(i, i * 3));
+		rehashed |= map.IsRehashing();
+
+		if (i % 7 == 0)
+			ASSERT(!map.Insert(i / 2, 0u));
+
+		if (i % 5 == 0)
+		{
+			ASSERT(map.Erase(i));
+			ASSERT(!map.Contains(i));
+			map.InsertOrAssign(i, i * 3);
+		}
+	}
+	ASSERT(rehashed);
+	ASSERT(map.Size() == 100'000);
+
+	for (U32 i = 0; i < 100'000; i++)
+		ASSERT(map.At(i) == i * 3);
+
+	map.InsertOrAssign(5u, 1u);
+	*map.Find(6u) = 2;
+	ASSERT(map.At(5u) == 1 && map.At(6u) == 2);
+
+	U64 count = 0;
+	map.ForEach([&](const U32&, const U32&) { count++; });
+	ASSERT(count == 100'000);
+
+	map.FinishRehash();
+	ASSERT(!map.IsRehashing());
+	ASSERT(map.Size() == 100'000);
+
+	map.Clear();
+	ASSERT(map.IsEmpty());
 }
 
 TEST_CASE("Containers/HashSet")
@@ -1443,6 +1902,39 @@ TEST_CASE("Containers/HashSet")
 		ASSERT(k > 0);
 	}
 
+	{
+		const U32 keys[] = { 1, 2, 3, 100 };
+		bool contains[4];
+		set2.ContainsBatch(Span<U32>(keys, 4), contains);
+		ASSERT(contains[0] && contains[1] && !contains[2] && !contains[3]);
+
+		HashSet<U32>::Iterator found[4];
+		set2.FindBatch(Span<U32>(keys, 4), found);
+		ASSERT(*found[1] == 2 && found[3] == set2.End());
+	}
+
+	{ // Const and heterogeneous lookups
+		StringHashSet<> strings;
+		strings.Insert(String<>("Hello"));
+		const StringHashSet<>& constStrings = strings;
+		ASSERT(constStrings.Contains(StringView("Hello")));
+		ASSERT(!constStrings.Contains(StringView("World")));
+		ASSERT(*constStrings.Find(StringView("Hello")) == "Hello");
+		ASSERT(strings.Find(StringView("World")) == strings.End());
+
+		const String<> words[] = { String<>("Hello"), String<>("World"), String<>("World"), String<>("Foo") };
+		ASSERT(strings.InsertRange(Span<String<>>(words, 4)) == 2);
+		ASSERT(strings.Size() == 3);
+		ASSERT(strings.Contains(StringView("Foo")));
+
+		Vector<U32> values;
+		for (U32 i = 0; i < 100; i++)
+			values.PushBack(i % 50);
+		HashSet<U32> numbers;
+		ASSERT(numbers.InsertRange(values) == 50);
+		ASSERT(numbers.Size() == 50);
+	}
+
 	set.Clear();
 	ASSERT(set.Size() == 0);
 	ASSERT(set.IsEmpty());
@@ -1450,6 +1942,1005 @@ TEST_CASE("Containers/HashSet")
 	ASSERT(typeid(set.GetAllocator()) == typeid(DefaultAllocator));
 }
 
+TEST_CASE("Containers/StringInterner")
+{
+	StringInterner<> interner;
+	ASSERT(interner.Size() == 0);
+	ASSERT(!interner.Find("Hello").IsValid());
+
+	const StringId hello = interner.Intern("Hello");
+	const StringId world = interner.Intern(String<>("World"));
+	ASSERT(hello.IsValid() && world.IsValid());
+	ASSERT(hello != world);
+	ASSERT(interner.Intern("Hello") == hello);
+	ASSERT(interner.Find("World") == world);
+	ASSERT(interner.Size() == 2);
+
+	ASSERT(interner.GetString(hello) == "Hello");
+	ASSERT(interner.GetString(world).Data()[5] == '\0');
+
+	{ // Ids and strings stay valid while more strings are interned
+		const char* helloData = interner.GetString(hello).Data();
+		Vector<StringId> ids;
+		for (U32 i = 0; i < 10'000; i++)
+			ids.PushBack(interner.Intern(std::format("String{}", i).c_str()));
+
+		ASSERT(interner.Size() == 10'002);
+		ASSERT(interner.GetString(hello).Data() == helloData);
+		for (U32 i = 0; i < 10'000; i++)
+			ASSERT(interner.GetString(ids[i]) == std::format("String{}", i).c_str());
+	}
+
+	{
+		StringIdHashMap<U32> map;
+		map.Insert(hello, 1u);
+		map.Insert(world, 2u);
+		ASSERT(map.At(hello) == 1);
+		ASSERT(map.At(interner.Intern("World")) == 2);
+
+		StringIdHashSet<> set;
+		set.Insert(hello);
+		ASSERT(set.Contains(hello));
+		ASSERT(!set.Contains(world));
+	}
+
+	{ // Concurrent interning of the same strings returns the same ids
+		StringInterner<> sharedInterner;
+		Vector<Vector<StringId>> threadIds;
+		threadIds.Resize(8);
+
+		Vector<std::thread> threads;
+		threads.Reserve(8);
+		for (U32 ti = 0; ti < 8; ti++)
+		{
+			threads.EmplaceBack([&, ti] {
+				for (U32 i = 0; i < 5'000; i++)
+				{
+					const StringId id = sharedInterner.Intern(std::format("Shared{}", (i * 7 + ti) % 5'000).c_str());
+					ASSERT(sharedInterner.GetString(id).StartsWith("Shared"));
+					threadIds[ti].PushBack(id);
+				}
+			});
+		}
+
+		for (auto& t : threads)
+			t.join();
+
+		ASSERT(sharedInterner.Size() == 5'000);
+		for (U32 ti = 0; ti < 8; ti++)
+		{
+			for (U32 i = 0; i < 5'000; i++)
+				ASSERT(sharedInterner.GetString(threadIds[ti][i]) == std::format("Shared{}", (i * 7 + ti) % 5'000).c_str());
+		}
+	}
+
+	ASSERT(GlobalStringInterner().GetString(GlobalStringInterner().Intern("Global")) == "Global");
+}
+
+TEST_CASE("Containers/ConcurrentHashMap")
+{
+	ConcurrentHashMap<U32, U32> map;
+	ASSERT(map.IsEmpty());
+	ASSERT(!map.Find(1u).has_value());
+
+	ASSERT(map.Insert(1u, 10u));
+	ASSERT(!map.Insert(1u, 20u));
+	ASSERT(map.Find(1u) == 10u);
+	ASSERT(map.Contains(1u));
+	ASSERT(map.Size() == 1);
+
+	map.InsertOrAssign(1u, 30u);
+	ASSERT(map.FindOrInsert(1u, 40u) == 30u);
+	ASSERT(map.FindOrInsert(2u, 50u) == 50u);
+
+	ASSERT(map.Update(2u, [](U32& value) { value++; }));
+	ASSERT(!map.Update(3u, [](U32& value) { value++; }));
+
+	U32 visited = 0;
+	ASSERT(map.Visit(2u, [&](const U32& value) { visited = value; }));
+	ASSERT(visited == 51);
+
+	U64 total = 0;
+	map.ForEachShard([&](const ConcurrentHashMap<U32, U32>::ShardMap& shard) {
+		for (const auto& [k, v] : shard)
+			total += v;
+	});
+	ASSERT(total == 81);
+
+	ASSERT(map.Erase(1u));
+	ASSERT(!map.Erase(1u));
+	map.Clear();
+	ASSERT(map.IsEmpty());
+
+	{ // Concurrent counters
+		ConcurrentHashMap<U32, U32> counters;
+		counters.Reserve(1'000);
+
+		Vector<std::thread> threads;
+		threads.Reserve(8);
+		for (U32 ti = 0; ti < 8; ti++)
+		{
+			threads.EmplaceBack([&, ti] {
+				for (U32 i = 0; i < 10'000; i++)
+				{
+					const U32 key = (i * 7 + ti) % 1'000;
+					[[maybe_unused]] const U32 _ = counters.FindOrInsert(key, 0u);
+					counters.Update(key, [](U32& value) { value++; });
+					ASSERT(counters.Contains(key));
+				}
+			});
+		}
+
+		for (auto& t : threads)
+			t.join();
+
+		ASSERT(counters.Size() == 1'000);
+		U64 count = 0;
+		counters.ForEachShard([&](const ConcurrentHashMap<U32, U32>::ShardMap& shard) {
+			for (const auto& [k, v] : shard)
+				count += v;
+		});
+		ASSERT(count == 80'000);
+	}
+
+	{ // Strings
+		ConcurrentHashMap<String<>, U32, DefaultAllocator, HeterogenousStringHash> strings;
+		strings.Insert(String<>("Hello"), 1u);
+		ASSERT(strings.Contains(StringView("Hello")));
+		ASSERT(strings.Find(StringView("Hello")) == 1u);
+		ASSERT(strings.Erase(StringView("Hello")));
+		ASSERT(!strings.Contains(StringView("Hello")));
+		ASSERT(!strings.Erase(StringView("Hello")));
+	}
+}
+
+TEST_CASE("Containers/LruCache")
+{
+	{
+		LruCache<U32, U32> cache(3);
+		ASSERT(cache.IsEmpty());
+		ASSERT(cache.Capacity() == 3);
+		ASSERT(cache.Get(1u) == nullptr);
+
+		cache.Put(1u, 10u);
+		cache.Put(2u, 20u);
+		cache.Put(3u, 30u);
+		ASSERT(*cache.Get(1u) == 10); // 2 is now the least recently used
+		cache.Put(4u, 40u);
+		ASSERT(cache.Size() == 3);
+		ASSERT(!cache.Contains(2u));
+		ASSERT(cache.Contains(1u) && cache.Contains(3u) && cache.Contains(4u));
+
+		ASSERT(cache.Put(3u, 31u) == 31); // Replacing makes 3 the most recent, 1 is the next one evicted
+		ASSERT(*cache.Peek(1u) == 10); // Peek doesn't change the order
+		cache.Put(5u, 50u);
+		ASSERT(!cache.Contains(1u));
+
+		ASSERT(cache.Erase(4u));
+		ASSERT(!cache.Erase(4u));
+		ASSERT(cache.Size() == 2);
+		cache.Put(6u, 60u);
+		cache.Put(7u, 70u);
+		ASSERT(!cache.Contains(3u));
+		ASSERT(*cache.Get(5u) == 50 && *cache.Get(6u) == 60 && *cache.Get(7u) == 70);
+
+		const CacheStats stats = cache.GetStats();
+		ASSERT(stats.hits == 4);
+		ASSERT(stats.misses == 1);
+		cache.ResetStats();
+		ASSERT(cache.GetStats().hits == 0);
+
+		cache.Clear();
+		ASSERT(cache.IsEmpty());
+		cache.Put(8u, 80u);
+		ASSERT(*cache.Get(8u) == 80);
+	}
+
+	{ // Non copyable keys and values
+		LruCache<String<>, String<>, DefaultAllocator, HeterogenousStringHash> cache(2);
+		cache.Put(String<>("a"), "A");
+		cache.Put(String<>("b"), "B");
+		ASSERT(*cache.Get(StringView("a")) == "A");
+		cache.Put(String<>("c"), "C");
+		ASSERT(!cache.Contains(StringView("b")));
+		ASSERT(cache.Erase(String<>("a")));
+		ASSERT(*cache.Get(StringView("c")) == "C");
+	}
+
+	{ // Clock keeps the entries that are hit
+		ClockCache<U32, U32> cache(4);
+		cache.Put(0u, 0u);
+		for (U32 i = 1; i < 100; i++)
+		{
+			ASSERT(cache.Get(0u) != nullptr);
+			cache.Put(i, i);
+			ASSERT(cache.Size() == Math::Min(i + 1, 4u));
+		}
+		ASSERT(cache.Contains(99u));
+
+		ASSERT(cache.Erase(0u));
+		cache.Put(100u, 100u);
+		ASSERT(cache.Contains(100u));
+	}
+
+	{ // Concurrent
+		ConcurrentLruCache<U32, U32> cache(1'024);
+		Vector<std::thread> threads;
+		threads.Reserve(8);
+		for (U32 ti = 0; ti < 8; ti++)
+		{
+			threads.EmplaceBack([&, ti] {
+				for (U32 i = 0; i < 10'000; i++)
+				{
+					const U32 key = (i * 13 + ti) % 4'096;
+					const std::optional<U32> value = cache.Get(key);
+					if (value.has_value())
+						ASSERT(*value == key * 2);
+					else
+						cache.Put(key, key * 2);
+				}
+			});
+		}
+
+		for (auto& t : threads)
+			t.join();
+
+		ASSERT(cache.Size() <= 1'024);
+		const CacheStats stats = cache.GetStats();
+		ASSERT(stats.hits + stats.misses == 80'000);
+	}
+}
+
+TEST_CASE("Containers/FlatMap")
+{
+	{
+		FlatMap<U32, U32> map;
+		ASSERT(map.IsEmpty());
+		ASSERT(map.TryFind(1u) == nullptr);
+
+		for (U32 i = 0; i < 100; i++)
+			ASSERT(map.Insert((i * 37) % 100, i));
+		ASSERT(!map.Insert(37u, 0u));
+		ASSERT(map.Size() == 100);
+		ASSERT(map.At(37u) == 1);
+
+		for (U32 i = 0; i < map.Size(); i++)
+			ASSERT(map.GetKey(i) == i); // Always sorted
+
+		map.InsertOrAssign(37u, 5u);
+		ASSERT(map.At(37u) == 5);
+
+		auto [begin, end] = map.Range(10u, 20u);
+		ASSERT(begin == 10 && end == 20);
+		ASSERT(map.LowerBound(100u) == map.Size());
+		ASSERT(map.UpperBound(10u) == 11);
+
+		ASSERT(map.Erase(10u));
+		ASSERT(!map.Erase(10u));
+		ASSERT(map.Find(10u) == map.Size());
+		ASSERT(map.LowerBound(10u) == 10);
+		ASSERT(map.GetKey(10) == 11);
+
+		map.BuildEytzingerIndex();
+		ASSERT(map.HasEytzingerIndex());
+		for (U32 i = 0; i < 110; i++)
+		{
+			ASSERT(map.LowerBound(i) == (i <= 10 ? i : Math::Min(i - 1, map.Size())));
+			ASSERT(map.Contains(i) == (i < 100 && i != 10));
+		}
+
+		map.Insert(10u, 10u); // Any modification drops the index
+		ASSERT(!map.HasEytzingerIndex());
+		ASSERT(map.Find(10u) == 10);
+
+		U32 expected = 0;
+		map.ForEach([&](U32 key, U32) { ASSERT(key == expected++); });
+		ASSERT(expected == 100);
+
+		map.Clear();
+		ASSERT(map.IsEmpty());
+	}
+
+	{ // Bulk build keeps the last duplicate
+		Vector<String<>> keys;
+		Vector<U32> values;
+		const char* names[] = { "b", "a", "c", "a", "b" };
+		for (U32 i = 0; i < 5; i++)
+		{
+			keys.EmplaceBack(names[i]);
+			values.EmplaceBack(i);
+		}
+
+		FlatMap<String<>, U32> map = FlatMap<String<>, U32>::BulkBuild(std::move(keys), std::move(values));
+		ASSERT(map.Size() == 3);
+		ASSERT(map.GetKey(0) == "a" && map.GetKey(2) == "c");
+		ASSERT(map.At(StringView("a")) == 3);
+		ASSERT(map.At(StringView("b")) == 4);
+		ASSERT(map.At(StringView("c")) == 2);
+		ASSERT(map.TryFind(StringView("d")) == nullptr);
+
+		map.BuildEytzingerIndex();
+		ASSERT(map.At(StringView("b")) == 4);
+		ASSERT(map.TryFind(StringView("0")) == nullptr);
+	}
+
+	{
+		Vector<S32> keys;
+		for (S32 key : { 5, -3, 5, 8, 0 })
+			keys.EmplaceBack(key);
+
+		FlatSet<S32> set = FlatSet<S32>::BulkBuild(std::move(keys));
+		ASSERT(set.Size() == 4);
+		ASSERT(*set.Begin() == -3);
+		ASSERT(set.Insert(2));
+		ASSERT(!set.Insert(2));
+		ASSERT(set.Erase(5));
+		ASSERT(!set.Contains(5));
+
+		S32 previous = -100;
+		for (S32 key : set)
+		{
+			ASSERT(key > previous);
+			previous = key;
+		}
+	}
+}
+
+TEST_CASE("Containers/BTreeMap")
+{
+	{
+		BTreeMap<U32, U32> map;
+		ASSERT(map.IsEmpty());
+		ASSERT(map.Find(1u) == map.End());
+		ASSERT(map.Begin() == map.End());
+
+		// Enough items for a few levels, inserted out of order
+		constexpr U32 N = 10'000;
+		for (U32 i = 0; i < N; i++)
+			ASSERT(map.Insert((i * 7'919) % N, i).second);
+		ASSERT(!map.Insert(7'919u, 0u).second);
+		ASSERT(map.Size() == N);
+		ASSERT(map.At(7'919u) == 1);
+
+		U32 expected = 0;
+		for (auto [key, value] : map)
+		{
+			ASSERT(key == expected);
+			ASSERT((value * 7'919) % N == key);
+			expected++;
+		}
+		ASSERT(expected == N);
+
+		map.InsertOrAssign(5u, 42u);
+		ASSERT(map.At(5u) == 42);
+
+		// Erase the odd keys
+		for (U32 i = 1; i < N; i += 2)
+			ASSERT(map.Erase(i));
+		ASSERT(!map.Erase(1u));
+		ASSERT(map.Size() == N / 2);
+		ASSERT(!map.Contains(101u));
+		ASSERT(map.Contains(100u));
+
+		ASSERT(map.LowerBound(101u).GetKey() == 102);
+		ASSERT(map.LowerBound(102u).GetKey() == 102);
+		ASSERT(map.UpperBound(102u).GetKey() == 104);
+		ASSERT(map.LowerBound(N) == map.End());
+		ASSERT(map.UpperBound(N - 2) == map.End());
+
+		U32 count = 0;
+		for (auto [key, value] : map.Range(1'000u, 2'000u))
+		{
+			ASSERT(key == 1'000 + count * 2);
+			count++;
+		}
+		ASSERT(count == 500);
+
+		for (U32 i = 0; i < N; i += 2)
+			ASSERT(map.Erase(i));
+		ASSERT(map.IsEmpty());
+		ASSERT(map.Begin() == map.End());
+	}
+
+	{ // Bulk build from sorted keys
+		Vector<U64> keys;
+		Vector<U64> values;
+		for (U64 i = 0; i < 5'000; i++)
+		{
+			keys.PushBack(i * 3);
+			values.PushBack(i);
+		}
+
+		BTreeMap<U64, U64> map = BTreeMap<U64, U64>::BulkBuild(std::move(keys), std::move(values));
+		ASSERT(map.Size() == 5'000);
+		ASSERT(map.At(300u) == 100);
+		ASSERT(!map.Contains(301u));
+		ASSERT(map.LowerBound(301u).GetKey() == 303);
+
+		map.Insert(301u, 0u);
+		ASSERT(map.Erase(300u));
+		ASSERT(map.LowerBound(300u).GetKey() == 301);
+
+		BTreeMap<U64, U64> moved = std::move(map);
+		ASSERT(moved.Size() == 5'000);
+		ASSERT(map.IsEmpty());
+	}
+
+	{ // Non trivial keys and values, searched with a StringView
+		BTreeMap<String<>, String<>> map;
+		map.Insert(String<>("b"), "B");
+		map.Insert(String<>("a"), "A");
+		map.Insert(String<>("c"), "C");
+		ASSERT(map.At(StringView("a")) == "A");
+		ASSERT(map.Begin().GetKey() == "a");
+		ASSERT(map.Erase(StringView("b")));
+		ASSERT(map.UpperBound(StringView("a")).GetKey() == "c");
+	}
+}
+
+TEST_CASE("Containers/SlotMap")
+{
+	SlotMap<String<>> map;
+	ASSERT(map.IsEmpty());
+	ASSERT(!map.Contains(SlotHandle{}));
+
+	const SlotHandle a = map.Insert("a");
+	const SlotHandle b = map.Insert("b");
+	const SlotHandle c = map.Insert("c");
+	ASSERT(map.Size() == 3);
+	ASSERT(map.At(a) == "a" && map.At(b) == "b" && map.At(c) == "c");
+
+	// The last item moves in the hole, the handles still find it
+	ASSERT(map.Erase(a));
+	ASSERT(!map.Erase(a));
+	ASSERT(!map.Contains(a));
+	ASSERT(map.TryFind(a) == nullptr);
+	ASSERT(map.Size() == 2);
+	ASSERT(map.At(c) == "c");
+	ASSERT(map.IndexOf(c) == 0);
+	ASSERT(map.GetHandle(0) == c);
+
+	// The slot of a is reused with another generation
+	const SlotHandle d = map.Insert("d");
+	ASSERT(d.index == a.index);
+	ASSERT(d != a);
+	ASSERT(!map.Contains(a));
+	ASSERT(map.At(d) == "d");
+	ASSERT(SlotHandle::FromU64(d.ToU64()) == d);
+
+	// Contiguous iteration
+	U32 count = 0;
+	for (auto [i, value] : Iter::Enumerate(map))
+	{
+		ASSERT(map.At(map.GetHandle(static_cast<U32>(i))) == value);
+		count++;
+	}
+	ASSERT(count == 3);
+	ASSERT(map.GetValues().Size() == 3);
+
+	for (String<>& value : map)
+		value += '!';
+	ASSERT(map.At(b) == "b!");
+
+	map.Clear();
+	ASSERT(map.IsEmpty());
+	ASSERT(!map.Contains(b) && !map.Contains(c) && !map.Contains(d));
+	const SlotHandle e = map.Insert("e");
+	ASSERT(map.At(e) == "e");
+
+	{ // Many inserts and erases
+		SlotMap<U32> numbers;
+		Vector<SlotHandle> handles;
+		for (U32 i = 0; i < 1'000; i++)
+			handles.PushBack(numbers.Insert(i));
+		for (U32 i = 0; i < 1'000; i += 2)
+			ASSERT(numbers.Erase(handles[i]));
+		for (U32 i = 0; i < 1'000; i++)
+		{
+			const U32* value = numbers.TryFind(handles[i]);
+			ASSERT((value != nullptr) == (i % 2 == 1));
+			ASSERT(value == nullptr || *value == i);
+		}
+		ASSERT(numbers.Size() == 500);
+	}
+}
+
+TEST_CASE("Containers/SparseSet")
+{
+	SparseSet<String<>> set;
+	ASSERT(set.IsEmpty());
+	ASSERT(!set.Contains(0));
+	ASSERT(!set.Contains(1u << 24u));
+
+	ASSERT(set.Insert(5, "five"));
+	ASSERT(set.Insert(1'000'000, "million"));
+	ASSERT(set.Insert(7, "seven"));
+	ASSERT(!set.Insert(5, "other"));
+	ASSERT(set.Size() == 3);
+	ASSERT(set.At(5) == "five");
+	ASSERT(set.At(1'000'000) == "million");
+	ASSERT(!set.Contains(6));
+	ASSERT(!set.Contains(2'000'000));
+
+	// The last item moves in the hole
+	ASSERT(set.Erase(5));
+	ASSERT(!set.Erase(5));
+	ASSERT(set.TryFind(5) == nullptr);
+	ASSERT(set.GetKeys()[0] == 7);
+	ASSERT(set.GetValues()[0] == "seven");
+	ASSERT(set.At(1'000'000) == "million");
+
+	set.InsertOrAssign(7, "SEVEN");
+	ASSERT(set.At(7) == "SEVEN");
+
+	U32 count = 0;
+	for (auto [i, value] : Iter::Enumerate(set))
+	{
+		ASSERT(set.At(set.GetKeys()[static_cast<U32>(i)]) == value);
+		count++;
+	}
+	ASSERT(count == 2);
+
+	SparseSet<String<>> moved = std::move(set);
+	ASSERT(moved.At(7) == "SEVEN");
+
+	moved.Clear();
+	ASSERT(moved.IsEmpty());
+	ASSERT(!moved.Contains(7));
+	ASSERT(moved.Insert(7, "again"));
+
+	{ // Intersection
+		SparseSet<U32> all;
+		SparseSet<U32> even;
+		SparseSet<U32> thirds;
+		for (U32 i = 0; i < 1'000; i++)
+		{
+			all.Insert(i, i);
+			if (i % 2 == 0)
+				even.Insert(i, i * 2);
+			if (i % 3 == 0)
+				thirds.Insert(i, i * 3);
+		}
+
+		U32 found = 0;
+		ForEachIntersection([&](U32 key, U32& a, U32& b, U32& c) {
+			ASSERT(key % 6 == 0);
+			ASSERT(a == key && b == key * 2 && c == key * 3);
+			found++;
+		}, all, even, thirds);
+		ASSERT(found == 167);
+	}
+}
+
+TEST_CASE("Containers/BitVector")
+{
+	BitVector bits(200);
+	ASSERT(bits.Size() == 200);
+	ASSERT(bits.None());
+	ASSERT(bits.FindFirstSet() == 200);
+
+	bits.Set(3);
+	bits.Set(64);
+	bits.Set(199);
+	ASSERT(bits.Test(3) && bits[64] && bits[199]);
+	ASSERT(!bits.Test(4));
+	ASSERT(bits.PopCount() == 3);
+	ASSERT(bits.FindFirstSet() == 3);
+	ASSERT(bits.FindNextSet(3) == 64);
+	ASSERT(bits.FindNextSet(64) == 199);
+	ASSERT(bits.FindNextSet(199) == 200);
+
+	U64 expected[] = { 3, 64, 199 };
+	U64 count = 0;
+	for (U64 index : bits.SetBits())
+		ASSERT(index == expected[count++]);
+	ASSERT(count == 3);
+
+	const Span<U64> words = bits.GetWords();
+	ASSERT(words.Size() == 4);
+	ASSERT(words[0] == (1llu << 3) && words[1] == 1 && words[3] == (1llu << 7));
+
+	BitVector mask(200, true);
+	ASSERT(mask.All());
+	ASSERT(mask.PopCount() == 200);
+	mask.Reset(64);
+	bits.And(mask);
+	ASSERT(bits.PopCount() == 2 && !bits.Test(64));
+	bits.Or(mask);
+	ASSERT(bits.PopCount() == 199);
+	bits.Xor(mask);
+	ASSERT(bits.None());
+	bits.Set(10);
+	bits.AndNot(mask);
+	ASSERT(bits.None());
+
+	bits.FlipAll();
+	ASSERT(bits.All());
+	bits.Resize(300);
+	ASSERT(bits.PopCount() == 200);
+	ASSERT(!bits.Test(250));
+	bits.Resize(100);
+	ASSERT(bits.PopCount() == 100);
+	bits.Resize(130, true);
+	ASSERT(bits.PopCount() == 130);
+	bits.PushBack(false);
+	ASSERT(bits.Size() == 131 && !bits.Test(130));
+
+	BitVector clone = bits.Clone();
+	ASSERT(clone.PopCount() == 130);
+
+	{ // Rank and select
+		BitVector sparse(10'000);
+		for (U64 i = 0; i < 10'000; i += 7)
+			sparse.Set(i);
+
+		BitRankSelect rankSelect;
+		ASSERT(rankSelect.Rank(0) == 0 && rankSelect.Select(0) == 0); // Not built yet
+
+		rankSelect.Build(sparse);
+		ASSERT(rankSelect.PopCount() == sparse.PopCount());
+		ASSERT(rankSelect.Rank(0) == 0);
+		ASSERT(rankSelect.Rank(1) == 1);
+		ASSERT(rankSelect.Rank(700) == 100);
+		ASSERT(rankSelect.Rank(701) == 101);
+		ASSERT(rankSelect.Rank(10'000) == sparse.PopCount());
+		ASSERT(rankSelect.Select(0) == 0);
+		ASSERT(rankSelect.Select(100) == 700);
+		ASSERT(rankSelect.Select(sparse.PopCount()) == 10'000);
+	}
+
+	{
+		FixedBitSet<100> fixed;
+		fixed.Set(99);
+		fixed.Set(0);
+		ASSERT(fixed.PopCount() == 2);
+		ASSERT(fixed.FindNextSet(0) == 99);
+		fixed.FlipAll();
+		ASSERT(fixed.PopCount() == 98);
+
+		FixedBitSet<100> other;
+		other.SetAll();
+		other.Reset(0);
+		other.Reset(99);
+		ASSERT(fixed == other);
+		fixed.AndNot(other);
+		ASSERT(fixed.None());
+	}
+}
+
+TEST_CASE("Containers/Filters")
+{
+	Vector<U64> keys;
+	for (U64 i = 0; i < 10'000; i++)
+		keys.PushBack(i * 7'919);
+	keys.PushBack(0); // Duplicates are allowed
+
+	BloomFilter<U64> bloom(keys.Size());
+	for (const U64 key : keys)
+		bloom.Insert(key);
+
+	XorFilter<U64> xorFilter;
+	xorFilter.Build(keys);
+
+	U64 bloomFalsePositives = 0;
+	U64 xorFalsePositives = 0;
+	for (U64 i = 0; i < 10'000; i++)
+	{
+		ASSERT(bloom.Contains(keys[static_cast<U32>(i)]));
+		ASSERT(xorFilter.Contains(keys[static_cast<U32>(i)]));
+		bloomFalsePositives += bloom.Contains(i * 7'919 + 1) ? 1 : 0;
+		xorFalsePositives += xorFilter.Contains(i * 7'919 + 1) ? 1 : 0;
+	}
+	ASSERT(bloomFalsePositives < 300);
+	ASSERT(xorFalsePositives < 100);
+
+	{ // Read back from a buffer without copying
+		Vector<Byte> bloomBuffer;
+		bloomBuffer.Resize(static_cast<U32>(bloom.SerializedSize()) + 32);
+		Byte* alignedBuffer = bloomBuffer.Data() + AlignedOffset(bloomBuffer.Data(), 32); // The blocks are read with aligned loads
+		bloom.Serialize(alignedBuffer);
+		const auto bloomView = BloomFilterView<U64>::FromBuffer(BigSpan<Byte>(alignedBuffer, bloom.SerializedSize()));
+		ASSERT(bloomView.has_value());
+		ASSERT(!XorFilterView<U64>::FromBuffer(BigSpan<Byte>(alignedBuffer, bloom.SerializedSize())).has_value());
+		ASSERT(!BloomFilterView<U64>::FromBuffer(BigSpan<Byte>(alignedBuffer, bloom.SerializedSize() - 1)).has_value());
+
+		{ // A corrupt block count whose byte size wraps to 0, and a misaligned buffer
+			Vector<Byte> corruptBuffer;
+			corruptBuffer.Resize(sizeof(Internal::FilterHeader) + 64);
+			Byte* corrupt = corruptBuffer.Data() + AlignedOffset(corruptBuffer.Data(), 32);
+			MemCopy(alignedBuffer, corrupt, sizeof(Internal::FilterHeader));
+			const U64 hugeSize = 1llu << 59llu;
+			MemCopy(&hugeSize, corrupt + offsetof(Internal::FilterHeader, size), sizeof(U64));
+			ASSERT(!BloomFilterView<U64>::FromBuffer(BigSpan<Byte>(corrupt, sizeof(Internal::FilterHeader) + 32)).has_value());
+
+			Vector<Byte> misaligned;
+			misaligned.Resize(static_cast<U32>(bloom.SerializedSize()) + 40);
+			Byte* misalignedData = misaligned.Data() + AlignedOffset(misaligned.Data(), 32) + 8;
+			bloom.Serialize(misalignedData);
+			ASSERT(!BloomFilterView<U64>::FromBuffer(BigSpan<Byte>(misalignedData, bloom.SerializedSize())).has_value());
+		}
+
+		Vector<Byte> xorBuffer;
+		xorBuffer.Resize(static_cast<U32>(xorFilter.SerializedSize()));
+		xorFilter.Serialize(xorBuffer.Data());
+		const auto xorView = XorFilterView<U64>::FromBuffer(BigSpan<Byte>(xorBuffer.Data(), xorBuffer.Size()));
+		ASSERT(xorView.has_value());
+		ASSERT(!XorFilterView<U64>::FromBuffer(BigSpan<Byte>(xorBuffer.Data(), xorBuffer.Size() - 1)).has_value());
+
+		for (U64 i = 0; i < 10'000; i++)
+		{
+			ASSERT(bloomView->Contains(i * 7'919));
+			ASSERT(xorView->Contains(i * 7'919));
+			ASSERT(bloomView->Contains(i * 7'919 + 1) == bloom.Contains(i * 7'919 + 1));
+			ASSERT(xorView->Contains(i * 7'919 + 1) == xorFilter.Contains(i * 7'919 + 1));
+		}
+	}
+
+	XorFilter<U64> empty;
+	empty.Build(Span<U64>());
+	ASSERT(!empty.Contains(0llu));
+
+	BloomFilter<String<>, DefaultAllocator, HeterogenousStringHash> strings(16);
+	strings.Insert(String("upstream"));
+	ASSERT(strings.Contains(String("upstream")));
+	ASSERT(strings.Contains(StringView("upstream")));
+	strings.Clear();
+	ASSERT(!strings.Contains(StringView("upstream")));
+}
+
+TEST_CASE("Containers/PriorityQueue")
+{
+	{
+		PriorityQueue<U32> queue;
+		ASSERT(queue.IsEmpty());
+		for (U32 i = 0; i < 100; i++)
+			queue.Push((i * 37) % 100);
+		ASSERT(queue.Size() == 100);
+		ASSERT(queue.Top() == 99);
+
+		Vector<U32> more;
+		for (U32 i = 0; i < 100; i++)
+			more.PushBack(i + 50);
+		queue.PushN(more);
+		ASSERT(queue.Size() == 200);
+
+		U32 previous = queue.Top();
+		while (!queue.IsEmpty())
+		{
+			const U32 value = queue.Pop();
+			ASSERT(value <= previous);
+			previous = value;
+		}
+	}
+
+	{
+		Vector<String<>> words;
+		words.PushBack(String<>("pear"));
+		words.PushBack(String<>("apple"));
+		words.PushBack(String<>("fig"));
+		PriorityQueue<String<>, DefaultAllocator, std::greater<>> queue(std::move(words));
+		ASSERT(queue.Pop() == "apple");
+		queue.Emplace("banana");
+		ASSERT(queue.Pop() == "banana");
+		ASSERT(queue.Pop() == "fig");
+		ASSERT(queue.Pop() == "pear");
+		ASSERT(queue.IsEmpty());
+
+		Vector<String<>> more; // Cloned, String<> is not copyable
+		more.PushBack(String<>("kiwi"));
+		more.PushBack(String<>("date"));
+		queue.PushN(more);
+		ASSERT(more[0] == "kiwi");
+		ASSERT(queue.Pop() == "date");
+		ASSERT(queue.Pop() == "kiwi");
+	}
+
+	{ // Indexed, as a min heap
+		IndexedPriorityQueue<U32, DefaultAllocator, std::greater<>> queue;
+		const SlotHandle a = queue.Push(50u);
+		const SlotHandle b = queue.Push(40u);
+		const SlotHandle c = queue.Push(30u);
+		const SlotHandle d = queue.Push(20u);
+		ASSERT(queue.Top() == 20);
+		ASSERT(queue.TopHandle() == d);
+
+		queue.DecreaseKey(a, 10);
+		ASSERT(queue.TopHandle() == a);
+		ASSERT(queue.Get(a) == 10);
+
+		queue.Update(a, 45);
+		ASSERT(queue.TopHandle() == d);
+
+		ASSERT(queue.Erase(c));
+		ASSERT(!queue.Erase(c));
+		ASSERT(!queue.Contains(c));
+		ASSERT(queue.Size() == 3);
+
+		ASSERT(queue.Pop() == 20);
+		ASSERT(!queue.Contains(d));
+		ASSERT(queue.Pop() == 40);
+		ASSERT(queue.Contains(a));
+
+		const SlotHandle e = queue.Push(5u); // Reuses a free slot with a new generation
+		ASSERT(e != b && e != c && e != d);
+		ASSERT(!queue.Contains(b));
+		ASSERT(queue.Pop() == 5);
+		ASSERT(queue.Pop() == 45);
+		ASSERT(queue.IsEmpty());
+
+		queue.Push(1u);
+		const SlotHandle f = queue.Push(2u);
+		queue.Clear();
+		ASSERT(queue.IsEmpty());
+		ASSERT(!queue.Contains(f));
+	}
+}
+
+TEST_CASE("Containers/TimerWheel")
+{
+	constexpr U64 Ms = 1'000'000;
+	TimerWheel wheel(Ms);
+	ASSERT(wheel.IsEmpty());
+
+	Vector<U32> fired;
+	wheel.Schedule(5 * Ms, [&fired] { fired.PushBack(5); });
+	wheel.Schedule(300 * Ms, [&fired] { fired.PushBack(300); }); // Second level
+	wheel.Schedule(70'000 * Ms, [&fired] { fired.PushBack(70'000); }); // Third level
+	const TimerHandle cancelled = wheel.Schedule(10 * Ms, [&fired] { fired.PushBack(10); });
+	ASSERT(wheel.Size() == 4);
+	ASSERT(wheel.IsScheduled(cancelled));
+	ASSERT(wheel.Cancel(cancelled));
+	ASSERT(!wheel.Cancel(cancelled));
+	ASSERT(!wheel.IsScheduled(cancelled));
+	ASSERT(wheel.Size() == 3);
+
+	ASSERT(wheel.Advance(4 * Ms + 999'999) == 0); // Never early
+	ASSERT(wheel.Advance(5 * Ms) == 1);
+	ASSERT(fired.Size() == 1 && fired[0] == 5);
+	ASSERT(wheel.Advance(299 * Ms) == 0);
+	ASSERT(wheel.Advance(100'000 * Ms) == 2);
+	ASSERT(fired.Size() == 3 && fired[1] == 300 && fired[2] == 70'000);
+	ASSERT(wheel.IsEmpty());
+
+	{ // Callbacks can cancel and schedule timers
+		U32 count = 0;
+		TimerHandle later;
+		wheel.ScheduleAfter(1 * Ms, [&wheel, &later] { wheel.Cancel(later); });
+		later = wheel.ScheduleAfter(2 * Ms, [&count] { count += 100; });
+		wheel.ScheduleAfter(1 * Ms, [&wheel, &count] { wheel.Schedule(0, [&count] { count++; }); });
+		ASSERT(wheel.Advance(wheel.GetNowNs() + 1 * Ms) == 2);
+		ASSERT(!wheel.IsScheduled(later));
+		ASSERT(count == 0);
+		ASSERT(wheel.Advance(wheel.GetNowNs()) == 1); // A deadline already reached fires in the next Advance()
+		ASSERT(count == 1);
+		ASSERT(wheel.IsEmpty());
+	}
+
+	{ // Beyond the 2^32 ticks of the levels
+		TimerWheel fine(1);
+		U32 count = 0;
+		fine.Schedule(1llu << 33llu, [&count] { count++; });
+		fine.Schedule((1llu << 32llu) + 5, [&count] { count++; });
+		ASSERT(fine.Advance(1llu << 32llu) == 0);
+		ASSERT(fine.Advance((1llu << 32llu) + 5) == 1);
+		ASSERT(fine.Advance(1llu << 34llu) == 1);
+		ASSERT(count == 2);
+
+		fine.Schedule((1llu << 34llu) + 1, [&count] { count++; });
+		fine.Clear();
+		ASSERT(fine.IsEmpty());
+		ASSERT(fine.Advance(1llu << 35llu) == 0);
+	}
+
+	{ // Move assignment onto a wheel with timers cancels them
+		struct LiveCounter
+		{
+			U32* live;
+			explicit LiveCounter(U32* live_) : live(live_) { (*live)++; }
+			LiveCounter(const LiveCounter& other) : live(other.live) { (*live)++; }
+			LiveCounter& operator=(const LiveCounter&) = default;
+			~LiveCounter() { (*live)--; }
+		};
+
+		U32 live = 0;
+		U32 count = 0;
+		TimerWheel target(Ms);
+		target.Schedule(3 * Ms, [&count] { count += 100; });
+		target.Schedule(1'000 * Ms, [counter = LiveCounter(&live), &count] { count += 100; });
+		ASSERT(live == 1);
+
+		TimerWheel source(Ms);
+		const TimerHandle kept = source.Schedule(2 * Ms, [&count] { count++; });
+		source.Schedule(500 * Ms, [&count] { count++; });
+
+		target = std::move(source);
+		ASSERT(target.Size() == 2);
+		ASSERT(source.IsEmpty());
+		ASSERT(target.IsScheduled(kept));
+		ASSERT(live == 0); // The callbacks of the replaced timers were destroyed
+		ASSERT(target.Advance(1'000 * Ms) == 2);
+		ASSERT(count == 2);
+		ASSERT(!target.IsScheduled(kept));
+
+		TimerWheel moved(std::move(target));
+		ASSERT(target.IsEmpty());
+		moved.Schedule(1'001 * Ms, [&count] { count++; });
+		ASSERT(moved.Advance(1'001 * Ms) == 1);
+		ASSERT(count == 3);
+	}
+}
+
+TEST_CASE("Containers/IntrusiveList")
+{
+	struct Waiter
+	{
+		U32 id = 0;
+		IntrusiveListHook lruHook;
+		IntrusiveListHook queueHook;
+	};
+
+	Vector<Waiter> waiters;
+	waiters.Resize(4);
+	for (U32 i = 0; i < 4; i++)
+		waiters[i].id = i;
+
+	{
+		IntrusiveList<Waiter, &Waiter::lruHook> lru;
+		IntrusiveList<Waiter, &Waiter::queueHook> queue;
+		ASSERT(lru.IsEmpty());
+
+		for (Waiter& waiter : waiters)
+		{
+			lru.PushBack(waiter);
+			queue.PushFront(waiter); // The same items in another order
+		}
+		ASSERT(lru.Size() == 4 && queue.Size() == 4);
+		ASSERT(lru.Front().id == 0 && lru.Back().id == 3);
+		ASSERT(queue.Front().id == 3 && queue.Back().id == 0);
+
+		lru.MoveToFront(waiters[2]);
+		U32 expected[] = { 2, 0, 1, 3 };
+		for (auto [i, waiter] : Iter::Enumerate(lru))
+			ASSERT(waiter.id == expected[i]);
+
+		// Removing from one list leaves the other untouched
+		lru.Remove(waiters[0]);
+		ASSERT(!waiters[0].lruHook.IsLinked());
+		ASSERT(waiters[0].queueHook.IsLinked());
+		ASSERT(lru.Size() == 3 && queue.Size() == 4);
+
+		ASSERT(lru.PopBack().id == 3);
+		ASSERT(queue.PopFront().id == 3);
+		auto it = lru.Remove(lru.Begin());
+		ASSERT(it->id == 1);
+		ASSERT(lru.Size() == 1);
+
+		IntrusiveList<Waiter, &Waiter::lruHook> other;
+		other.PushBack(waiters[0]);
+		other.PushBack(waiters[3]);
+		lru.Splice(lru.Begin(), other);
+		ASSERT(other.IsEmpty());
+		U32 spliced[] = { 0, 3, 1 };
+		U32 count = 0;
+		for (const Waiter& waiter : lru)
+			ASSERT(waiter.id == spliced[count++]);
+		ASSERT(count == 3);
+
+		other.Splice(other.End(), lru, waiters[3]);
+		ASSERT(lru.Size() == 2 && other.Size() == 1);
+
+		IntrusiveList<Waiter, &Waiter::lruHook> moved(std::move(lru));
+		ASSERT(lru.IsEmpty());
+		ASSERT(moved.Size() == 2);
+		ASSERT(moved.Back().id == 1);
+		ASSERT((--moved.End())->id == 1);
+	}
+
+	// The lists unlinked their items when destroyed
+	for (const Waiter& waiter : waiters)
+		ASSERT(!waiter.lruHook.IsLinked() && !waiter.queueHook.IsLinked());
+}
+
 TEST_CASE("Containers/UniquePtr")
 {
 	{
@@ -1859,6 +3350,41 @@ TEST_CASE("Containers/Function")
 	}
 }
 
+static int DoubleValue(int x) { return x * 2; }
+static int CallFunctionRef(FunctionRef<int(int)> func, int x) { return func(x); }
+
+TEST_CASE("Containers/FunctionRef")
+{
+	static_assert(sizeof(FunctionRef<int(int)>) == 2 * sizeof(void*));
+	static_assert(std::is_trivially_copyable_v<FunctionRef<int(int)>>);
+
+	{ // Free function and function pointer
+		ASSERT(CallFunctionRef(DoubleValue, 3) == 6);
+		ASSERT(CallFunctionRef(&DoubleValue, 4) == 8);
+		ASSERT(CallFunctionRef(+[](int x) { return x - 1; }, 4) == 3);
+	}
+
+	{ // Lambda with capture, referenced and not copied
+		int calls = 0;
+		auto counter = [&calls](int x) { return x + ++calls; };
+		ASSERT(CallFunctionRef(counter, 1) == 2);
+
+		FunctionRef<int(int)> ref = counter;
+		FunctionRef<int(int)> copy = ref;
+		ASSERT(copy(1) == 3);
+		ASSERT(calls == 2);
+	}
+
+	{ // Void return and Function callee
+		int sum = 0;
+		Function<void(int)> func = [&sum](int x) { sum += x; };
+		FunctionRef<void(int)> ref = func;
+		ref(2);
+		ref(3);
+		ASSERT(sum == 5);
+	}
+}
+
 template<typename DequeT>
 void TestDeque(AllocatorRef<typename DequeT::AllocatorType> allocator)
 {
@@ -68,4 +68,59 @@ TEST_CASE("Formatters/WString")
 		os << str;
 		ASSERT(os.str() == L"Hello, World!");
 	}
-}
\ No newline at end of file
+}
+
+TEST_CASE("Formatters/InplaceString")
+{
+	{
+		InplaceString<32> str("Hello, World!");
+		std::string formatted = std::format("{:>15}", str);
+		ASSERT(formatted == "  Hello, World!");
+	}
+
+	{
+		String<DefaultNonTrackingAllocator> str("Hello, World!");
+		std::string formatted = std::format("{}", str);
+		ASSERT(formatted == "Hello, World!");
+	}
+
+	{
+		InplaceWString<32> str(L"Hello, World!");
+		std::wostringstream os;
+		os << str;
+		ASSERT(os.str() == L"Hello, World!");
+	}
+}
+
+TEST_CASE("Formatters/FormatTo")
+{
+	{
+		String<> str("Value: ");
+		FormatTo(str, "{} {:.2f} {}", 42, 1.5f, StringView("end"));
+		ASSERT(str == "Value: 42 1.50 end");
+	}
+
+	{ // Grows past the inplace buffer
+		String<> str;
+		for (U32 i = 0; i < 100; i++)
+			FormatTo(str, "{},", i);
+		ASSERT(str.Size() == 290);
+		ASSERT(str.StartsWith("0,1,2,"));
+		ASSERT(str.EndsWith("98,99,"));
+	}
+
+	{
+		WString<> str;
+		FormatTo(str, L"{}-{}", 1, WStringView(L"two"));
+		ASSERT(str == L"1-two");
+	}
+
+	{
+		auto str = Format<InplaceString<64>>("{}/{}", "Formatters", 64);
+		ASSERT(str == "Formatters/64");
+		ASSERT(str.Capacity() == InplaceString<64>::InplaceCapacity);
+
+		String<> str2 = Format("{:08x}", 0xBEEFu);
+		ASSERT(str2 == "0000beef");
+	}
+}